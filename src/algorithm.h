@@ -9,12 +9,431 @@
 #define __estd__algorithm__
 
 #include "type.h"
+#include "type_traits.h"
+#include "utility.h"
 
 namespace estd {
 
-template <class T> void swap(T &a, T &b) noexcept {}
+/**
+ * @brief Exchanges the given values.
+ */
+template <class T> constexpr void swap(T &a, T &b) noexcept {
+  T temp = ::estd::move(a);
+  a = ::estd::move(b);
+  b = ::estd::move(temp);
+}
+
+/**
+ * @brief Exchanges the given arrays element by element.
+ */
+template <class T2, ::estd::size_t N> constexpr void swap(T2 (&a)[N], T2 (&b)[N]) noexcept {
+  for (::estd::size_t i = 0; i < N; ++i) {
+    ::estd::swap(a[i], b[i]);
+  }
+}
+
+namespace detail {
+
+template <class Iterator>
+using iterator_value_t = typename ::estd::remove_cvref<decltype(*::estd::declval<Iterator>())>::type;
+
+}; // namespace detail
+
+/**
+ * @brief function object performing lhs < rhs
+ */
+struct less {
+  template <class T, class U> constexpr bool operator()(T const &lhs, U const &rhs) const noexcept {
+    return lhs < rhs;
+  }
+};
+
+/**
+ * @brief function object performing lhs == rhs
+ */
+struct equal_to {
+  template <class T, class U> constexpr bool operator()(T const &lhs, U const &rhs) const noexcept {
+    return lhs == rhs;
+  }
+};
+
+/**
+ * @brief Returns the smallest element in the range [first, last).
+ * @param  first: beginning of range
+ * @param  last: end of range
+ * @param  comp: comparison function object which returns true if the first argument is less than the second
+ * @return ForwardIt: iterator to the first smallest element, last if the range is empty
+ */
+template <class ForwardIt, class Compare>
+constexpr ForwardIt min_element(ForwardIt first, ForwardIt last, Compare comp) {
+  if (first == last) {
+    return last;
+  }
+  ForwardIt smallest = first;
+  while (++first != last) {
+    if (comp(*first, *smallest)) {
+      smallest = first;
+    }
+  }
+  return smallest;
+}
+template <class ForwardIt> constexpr ForwardIt min_element(ForwardIt first, ForwardIt last) {
+  return ::estd::min_element(first, last, ::estd::less{});
+}
+
+/**
+ * @brief Reverses the order of the elements in the range [first, last).
+ */
+template <class RandomIt> constexpr void reverse(RandomIt first, RandomIt last) {
+  while (first < last) {
+    --last;
+    ::estd::swap(*first, *last);
+    ++first;
+  }
+}
+
+/**
+ * @brief Rotates the range [first, last) to the left so that middle becomes the first element. Blocks are swapped in
+ * place so every element is moved about once.
+ * @param  first: beginning of range
+ * @param  middle: element which should appear at the beginning of the rotated range
+ * @param  last: end of range
+ * @return RandomIt: iterator to the new position of the element pointed by first
+ */
+template <class RandomIt> constexpr RandomIt rotate(RandomIt first, RandomIt middle, RandomIt last) {
+  if (first == middle) {
+    return last;
+  }
+  if (middle == last) {
+    return first;
+  }
+  ::estd::ptrdiff_t n = last - first;
+  ::estd::ptrdiff_t k = middle - first;
+  RandomIt const result = first + (last - middle);
+  RandomIt p = first;
+  while (true) {
+    if (k == 1) {
+      // rotating by one element shifts the rest, which is cheaper than swapping one element through the range
+      ::estd::detail::iterator_value_t<RandomIt> value = ::estd::move(p[0]);
+      for (::estd::ptrdiff_t i = 1; i < n; ++i) {
+        p[i - 1] = ::estd::move(p[i]);
+      }
+      p[n - 1] = ::estd::move(value);
+      return result;
+    }
+    if (n - k == 1) {
+      ::estd::detail::iterator_value_t<RandomIt> value = ::estd::move(p[n - 1]);
+      for (::estd::ptrdiff_t i = n - 1; i > 0; --i) {
+        p[i] = ::estd::move(p[i - 1]);
+      }
+      p[0] = ::estd::move(value);
+      return result;
+    }
+    if (k < n - k) {
+      // swap left block of k elements forward until less than k elements remain
+      RandomIt const q = p + k;
+      for (::estd::ptrdiff_t i = 0; i < n - k; ++i) {
+        ::estd::swap(p[i], q[i]);
+      }
+      p += n - k;
+      n %= k;
+      if (n == 0) {
+        return result;
+      }
+      ::estd::swap(n, k);
+      k = n - k;
+    } else {
+      // swap right block of n - k elements backward
+      k = n - k;
+      RandomIt const q = p + n;
+      p = q - k;
+      for (::estd::ptrdiff_t i = 1; i <= n - k; ++i) {
+        ::estd::swap(p[-i], q[-i]);
+      }
+      p -= n - k;
+      n %= k;
+      if (n == 0) {
+        return result;
+      }
+      ::estd::swap(n, k);
+    }
+  }
+}
+
+/**
+ * @brief Reorders the elements in the range [first, last) so that all elements for which pred returns true precede the
+ * elements for which pred returns false. Relative order of the elements is not preserved.
+ * @param  first: beginning of range
+ * @param  last: end of range
+ * @param  pred: unary predicate
+ * @return ForwardIt: iterator to the first element of the second group
+ */
+template <class ForwardIt, class UnaryPredicate>
+constexpr ForwardIt partition(ForwardIt first, ForwardIt last, UnaryPredicate pred) {
+  while (first != last && pred(*first)) {
+    ++first;
+  }
+  if (first == last) {
+    return first;
+  }
+  for (ForwardIt it = first; ++it != last;) {
+    if (pred(*it)) {
+      ::estd::swap(*it, *first);
+      ++first;
+    }
+  }
+  return first;
+}
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) which is not less than value. The search has a
+ * fixed number of iterations for a given length and no data dependent branch.
+ * @param  first: beginning of range
+ * @param  last: end of range
+ * @param  value: value to compare the elements to
+ * @param  comp: comparison function object which returns true if the first argument is less than the second
+ * @return RandomIt: iterator to the first element not less than value, last if there is no such element
+ */
+template <class RandomIt, class T, class Compare>
+constexpr RandomIt lower_bound(RandomIt first, RandomIt last, T const &value, Compare comp) {
+  ::estd::size_t length = static_cast<::estd::size_t>(last - first);
+  if (length == 0U) {
+    return first;
+  }
+  while (length > 1U) {
+    ::estd::size_t const half = length / 2U;
+    first += comp(first[half], value) ? half : 0U;
+    length -= half;
+  }
+  return first + (comp(*first, value) ? 1 : 0);
+}
+template <class RandomIt, class T> constexpr RandomIt lower_bound(RandomIt first, RandomIt last, T const &value) {
+  return ::estd::lower_bound(first, last, value, ::estd::less{});
+}
+
+/**
+ * @brief Returns the first element in the sorted range [first, last) which is greater than value. The search has a
+ * fixed number of iterations for a given length and no data dependent branch.
+ * @param  first: beginning of range
+ * @param  last: end of range
+ * @param  value: value to compare the elements to
+ * @param  comp: comparison function object which returns true if the first argument is less than the second
+ * @return RandomIt: iterator to the first element greater than value, last if there is no such element
+ */
+template <class RandomIt, class T, class Compare>
+constexpr RandomIt upper_bound(RandomIt first, RandomIt last, T const &value, Compare comp) {
+  ::estd::size_t length = static_cast<::estd::size_t>(last - first);
+  if (length == 0U) {
+    return first;
+  }
+  while (length > 1U) {
+    ::estd::size_t const half = length / 2U;
+    first += comp(value, first[half]) ? 0U : half;
+    length -= half;
+  }
+  return first + (comp(value, *first) ? 0 : 1);
+}
+template <class RandomIt, class T> constexpr RandomIt upper_bound(RandomIt first, RandomIt last, T const &value) {
+  return ::estd::upper_bound(first, last, value, ::estd::less{});
+}
+
+namespace detail {
+
+// partitions shorter than this are left to insertion sort
+constexpr ::estd::ptrdiff_t kInsertionSortThreshold = 16;
+
+template <class RandomIt, class Compare> constexpr void insertion_sort(RandomIt first, RandomIt last, Compare &comp) {
+  if (first == last) {
+    return;
+  }
+  for (RandomIt it = first + 1; it != last; ++it) {
+    iterator_value_t<RandomIt> value = ::estd::move(*it);
+    RandomIt hole = it;
+    while (hole != first && comp(value, *(hole - 1))) {
+      *hole = ::estd::move(*(hole - 1));
+      --hole;
+    }
+    *hole = ::estd::move(value);
+  }
+}
+
+// inserts every element of [first, last) into the sorted prefix before it, *(first - 1) must not be greater than any
+// element so no bound check is needed
+template <class RandomIt, class Compare>
+constexpr void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare &comp) {
+  for (RandomIt it = first; it != last; ++it) {
+    iterator_value_t<RandomIt> value = ::estd::move(*it);
+    RandomIt hole = it;
+    while (comp(value, *(hole - 1))) {
+      *hole = ::estd::move(*(hole - 1));
+      --hole;
+    }
+    *hole = ::estd::move(value);
+  }
+}
 
-template <class T2, ::estd::size_t N> void swap(T2 (&a)[N], T2 (&b)[N]) noexcept {}
+template <class RandomIt, class Compare>
+constexpr void sift_down(RandomIt first, ::estd::ptrdiff_t hole, ::estd::ptrdiff_t length, Compare &comp) {
+  iterator_value_t<RandomIt> value = ::estd::move(first[hole]);
+  while (true) {
+    ::estd::ptrdiff_t child = 2 * hole + 1;
+    if (child >= length) {
+      break;
+    }
+    if (child + 1 < length && comp(first[child], first[child + 1])) {
+      ++child;
+    }
+    if (!comp(value, first[child])) {
+      break;
+    }
+    first[hole] = ::estd::move(first[child]);
+    hole = child;
+  }
+  first[hole] = ::estd::move(value);
+}
+
+template <class RandomIt, class Compare> constexpr void heap_sort(RandomIt first, RandomIt last, Compare &comp) {
+  ::estd::ptrdiff_t const length = last - first;
+  for (::estd::ptrdiff_t parent = length / 2; parent > 0;) {
+    --parent;
+    ::estd::detail::sift_down(first, parent, length, comp);
+  }
+  for (::estd::ptrdiff_t end = length; end > 1;) {
+    --end;
+    ::estd::swap(first[0], first[end]);
+    ::estd::detail::sift_down(first, 0, end, comp);
+  }
+}
+
+// moves the median of *a, *b and *c to *result
+template <class RandomIt, class Compare>
+constexpr void move_median_to_first(RandomIt result, RandomIt a, RandomIt b, RandomIt c, Compare &comp) {
+  if (comp(*a, *b)) {
+    if (comp(*b, *c)) {
+      ::estd::swap(*result, *b);
+    } else if (comp(*a, *c)) {
+      ::estd::swap(*result, *c);
+    } else {
+      ::estd::swap(*result, *a);
+    }
+  } else if (comp(*a, *c)) {
+    ::estd::swap(*result, *a);
+  } else if (comp(*b, *c)) {
+    ::estd::swap(*result, *c);
+  } else {
+    ::estd::swap(*result, *b);
+  }
+}
+
+// partitions (first, last) around median of three which is moved to *first, the median bounds both scans
+template <class RandomIt, class Compare>
+constexpr RandomIt partition_pivot(RandomIt first, RandomIt last, Compare &comp) {
+  ::estd::detail::move_median_to_first(first, first + 1, first + (last - first) / 2, last - 1, comp);
+  RandomIt const pivot = first;
+  RandomIt left = first + 1;
+  RandomIt right = last;
+  while (true) {
+    while (comp(*left, *pivot)) {
+      ++left;
+    }
+    --right;
+    while (comp(*pivot, *right)) {
+      --right;
+    }
+    if (!(left < right)) {
+      return left;
+    }
+    ::estd::swap(*left, *right);
+    ++left;
+  }
+}
+
+template <class RandomIt, class Compare>
+constexpr void introsort_loop(RandomIt first, RandomIt last, ::estd::size_t depth_limit, Compare &comp) {
+  while (last - first > kInsertionSortThreshold) {
+    if (depth_limit == 0U) {
+      ::estd::detail::heap_sort(first, last, comp);
+      return;
+    }
+    --depth_limit;
+    RandomIt const cut = ::estd::detail::partition_pivot(first, last, comp);
+    // recurse into the smaller side so that stack depth is O(log n)
+    if (cut - first < last - cut) {
+      ::estd::detail::introsort_loop(first, cut, depth_limit, comp);
+      first = cut;
+    } else {
+      ::estd::detail::introsort_loop(cut, last, depth_limit, comp);
+      last = cut;
+    }
+  }
+}
+
+constexpr ::estd::size_t introsort_depth_limit(::estd::ptrdiff_t length) noexcept {
+  ::estd::size_t depth = 0U;
+  for (::estd::ptrdiff_t n = length; n > 1; n /= 2) {
+    ++depth;
+  }
+  return 2U * depth;
+}
+
+}; // namespace detail
+
+/**
+ * @brief Sorts the elements in the range [first, last) in non-descending order by introsort. Quick sort with median of
+ * three pivot falls back to heap sort when recursion is too deep, and short partitions are finished by insertion sort.
+ * Worst case is O(n log n), no memory is allocated and order of equal elements is not preserved.
+ * @param  first: beginning of range
+ * @param  last: end of range
+ * @param  comp: comparison function object which returns true if the first argument is less than the second
+ */
+template <class RandomIt, class Compare> constexpr void sort(RandomIt first, RandomIt last, Compare comp) {
+  ::estd::detail::introsort_loop(first, last, ::estd::detail::introsort_depth_limit(last - first), comp);
+  if (last - first > ::estd::detail::kInsertionSortThreshold) {
+    // the smallest element is in the first partition, it guards the rest
+    RandomIt const middle = first + ::estd::detail::kInsertionSortThreshold;
+    ::estd::detail::insertion_sort(first, middle, comp);
+    ::estd::detail::unguarded_insertion_sort(middle, last, comp);
+  } else {
+    ::estd::detail::insertion_sort(first, last, comp);
+  }
+}
+template <class RandomIt> constexpr void sort(RandomIt first, RandomIt last) {
+  ::estd::sort(first, last, ::estd::less{});
+}
+
+/**
+ * @brief Partially sorts the range [first, last) so that nth is the element which would be there if the range was
+ * sorted, no element in [first, nth) is greater than it and no element in (nth, last) is less than it. Average O(n),
+ * worst case O(n log n) by falling back to heap sort.
+ * @param  first: beginning of range
+ * @param  nth: position to be sorted
+ * @param  last: end of range
+ * @param  comp: comparison function object which returns true if the first argument is less than the second
+ */
+template <class RandomIt, class Compare>
+constexpr void nth_element(RandomIt first, RandomIt nth, RandomIt last, Compare comp) {
+  if (first == last || nth == last) {
+    return;
+  }
+  ::estd::size_t depth_limit = ::estd::detail::introsort_depth_limit(last - first);
+  while (last - first > ::estd::detail::kInsertionSortThreshold) {
+    if (depth_limit == 0U) {
+      ::estd::detail::heap_sort(first, last, comp);
+      return;
+    }
+    --depth_limit;
+    RandomIt const cut = ::estd::detail::partition_pivot(first, last, comp);
+    if (cut <= nth) {
+      first = cut;
+    } else {
+      last = cut;
+    }
+  }
+  ::estd::detail::insertion_sort(first, last, comp);
+}
+template <class RandomIt> constexpr void nth_element(RandomIt first, RandomIt nth, RandomIt last) {
+  ::estd::nth_element(first, nth, last, ::estd::less{});
+}
 
 }; // namespace estd
 
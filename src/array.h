@@ -10,12 +10,96 @@
 
 #include "abort.h"
 #include "algorithm.h"
+#include "memory.h"
 #include "type.h"
 #include "type_traits.h"
 #include "utility.h"
 
 namespace estd {
 
+namespace detail {
+
+// single byte elements can be filled by memset
+template <class T>
+struct is_bytewise_fillable
+    : ::estd::integral_constant<bool, sizeof(T) == 1U && ::estd::is_trivially_copyable<T>::value> {};
+
+// elements can be compared for equality by memcmp
+template <class T>
+struct is_bitwise_equality_comparable
+    : ::estd::integral_constant<bool, ::estd::is_integral<T>::value || ::estd::is_pointer<T>::value> {};
+
+// elements can be compared lexicographically by memcmp
+template <class T>
+struct is_bitwise_lexicographical_comparable
+    : ::estd::integral_constant<bool, ::estd::is_same<typename ::estd::remove_cv<T>::type, unsigned char>::value ||
+                                          ::estd::is_same<typename ::estd::remove_cv<T>::type, bool>::value> {};
+
+template <class T> constexpr void fill_n(T *first, ::estd::size_t count, const T &value, ::estd::false_type) noexcept {
+  for (::estd::size_t i = 0; i < count; ++i) {
+    first[i] = value;
+  }
+}
+template <class T> constexpr void fill_n(T *first, ::estd::size_t count, const T &value, ::estd::true_type) noexcept {
+  if (::estd::is_constant_evaluated()) {
+    ::estd::detail::fill_n(first, count, value, ::estd::false_type{});
+    return;
+  }
+  unsigned char byte{};
+  ::estd::memcpy(&byte, &value, 1U);
+  ::estd::memset(first, byte, count);
+}
+
+template <class T>
+constexpr bool equal_n(const T *lhs, const T *rhs, ::estd::size_t count, ::estd::false_type) noexcept {
+  for (::estd::size_t i = 0; i < count; ++i) {
+    if (!(lhs[i] == rhs[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+template <class T>
+constexpr bool equal_n(const T *lhs, const T *rhs, ::estd::size_t count, ::estd::true_type) noexcept {
+  if (::estd::is_constant_evaluated()) {
+    return ::estd::detail::equal_n(lhs, rhs, count, ::estd::false_type{});
+  }
+  return count == 0U || ::estd::memcmp(lhs, rhs, count * sizeof(T)) == 0;
+}
+
+template <class T>
+constexpr bool less_n(const T *lhs, const T *rhs, ::estd::size_t count, ::estd::false_type) noexcept {
+  for (::estd::size_t i = 0; i < count; ++i) {
+    if (lhs[i] < rhs[i]) {
+      return true;
+    }
+    if (rhs[i] < lhs[i]) {
+      return false;
+    }
+  }
+  return false;
+}
+template <class T>
+constexpr bool less_n(const T *lhs, const T *rhs, ::estd::size_t count, ::estd::true_type) noexcept {
+  if (::estd::is_constant_evaluated()) {
+    return ::estd::detail::less_n(lhs, rhs, count, ::estd::false_type{});
+  }
+  return count != 0U && ::estd::memcmp(lhs, rhs, count * sizeof(T)) < 0;
+}
+
+template <class T> constexpr void swap_n(T *lhs, T *rhs, ::estd::size_t count) noexcept {
+  for (::estd::size_t i = 0; i < count; ++i) {
+    ::estd::swap(lhs[i], rhs[i]);
+  }
+}
+
+template <class T, class... Args> struct all_same : ::estd::true_type {};
+template <class T, class Head, class... Args>
+struct all_same<T, Head, Args...>
+    : ::estd::integral_constant<bool, ::estd::is_same<T, Head>::value && all_same<T, Args...>::value> {};
+
+}; // namespace detail
+
 template <class T, ::estd::size_t N> class Array {
 public:
   using value_type = T;
@@ -28,27 +112,48 @@ public:
   using iterator = pointer;
   using const_iterator = const_pointer;
 
-  Array() : data_{} {}
-  template <class _Tp, class... _Args> Array(_Tp value, _Args... args) { init(0, value, args...); }
+  constexpr Array() : data_{} {}
+  /**
+   * @brief initializes the leading elements from values, every element is copy or move constructed once directly from
+   * its argument and the remaining elements are value initialized
+   * @param  value: value of the first element, its type must be T
+   * @param  args: values of the following elements, their type must be T
+   */
+  template <class _Tp, class... _Args,
+            class = typename ::estd::enable_if<
+                ::estd::is_same<typename ::estd::remove_cvref<_Tp>::type, value_type>::value>::type>
+  constexpr Array(_Tp &&value, _Args &&...args) : data_{::estd::forward<_Tp>(value), ::estd::forward<_Args>(args)...} {
+    static_assert(::estd::detail::all_same<value_type, typename ::estd::remove_cvref<_Args>::type...>::value,
+                  "initialized type does not match Array type");
+    static_assert(sizeof...(_Args) < N, "too many initializers for Array");
+  }
+  /**
+   * @brief constructs every element in place from args, only available when T is constructible from args
+   * @param  args: arguments of the constructor of T, used for every element
+   */
+  template <class... _Args,
+            class = typename ::estd::enable_if<::estd::is_constructible<value_type, _Args const &...>::value>::type>
+  constexpr explicit Array(::estd::in_place_t, _Args const &...args)
+      : Array{::estd::make_index_sequence<N>{}, args...} {}
 
   /**
    * @brief access specified element
    * @param  pos: specified location pos
    * @return reference: specified element
    */
-  reference operator[](size_type pos) noexcept { return data_[pos]; }
-  const_reference operator[](size_type pos) const noexcept { return data_[pos]; }
+  constexpr reference operator[](size_type pos) noexcept { return data_[pos]; }
+  constexpr const_reference operator[](size_type pos) const noexcept { return data_[pos]; }
 
   /**
    * @brief access specified element with bounds checking(abort)
    * @param  pos: specified location pos
    * @return reference: specified element
    */
-  reference at(size_type pos) noexcept {
+  constexpr reference at(size_type pos) noexcept {
     this->check(pos);
     return data_[pos];
   }
-  const_reference at(size_type pos) const noexcept {
+  constexpr const_reference at(size_type pos) const noexcept {
     this->check(pos);
     return data_[pos];
   }
@@ -57,30 +162,30 @@ public:
    * @brief access the first element
    * @return reference: first element
    */
-  reference front() noexcept { return data_[0]; }
-  const_reference front() const noexcept { return data_[0]; }
+  constexpr reference front() noexcept { return data_[0]; }
+  constexpr const_reference front() const noexcept { return data_[0]; }
 
   /**
    * @brief access the last element
    * @return reference: last element
    */
-  reference back() noexcept { return data_[N - 1]; }
-  const_reference back() const noexcept { return data_[N - 1]; }
+  constexpr reference back() noexcept { return data_[N - 1]; }
+  constexpr const_reference back() const noexcept { return data_[N - 1]; }
 
   /**
    * @brief direct access to the underlying array
    * @return pointer: underlying array pointer
    */
-  pointer data() noexcept { return &data_[0]; }
-  const_pointer data() const noexcept { return &data_[0]; }
+  constexpr pointer data() noexcept { return &data_[0]; }
+  constexpr const_pointer data() const noexcept { return &data_[0]; }
 
-  iterator begin() noexcept { return &data_[0]; }
-  const_iterator begin() const noexcept { return &data_[0]; }
-  const_iterator cbegin() const noexcept { return &data_[0]; }
+  constexpr iterator begin() noexcept { return &data_[0]; }
+  constexpr const_iterator begin() const noexcept { return &data_[0]; }
+  constexpr const_iterator cbegin() const noexcept { return &data_[0]; }
 
-  iterator end() noexcept { return &data_[N]; }
-  const_iterator end() const noexcept { return &data_[N]; }
-  const_iterator cend() const noexcept { return &data_[N]; }
+  constexpr iterator end() noexcept { return &data_[N]; }
+  constexpr const_iterator end() const noexcept { return &data_[N]; }
+  constexpr const_iterator cend() const noexcept { return &data_[N]; }
 
   // reverse_iterator rbegin() noexcept;
   // const_reverse_iterator rbegin() const noexcept;
@@ -94,26 +199,24 @@ public:
    * @return true: container is empty
    * @return false: container is not empty
    */
-  bool empty() const noexcept { return N == 0; }
+  constexpr bool empty() const noexcept { return N == 0; }
   /**
    * @brief returns the number of elements
    * @return size_type: number of elements
    */
-  size_type size() const noexcept { return N; }
+  constexpr size_type size() const noexcept { return N; }
   /**
    * @brief returns the maximum possible number of elements
    * @return size_type: maximum possible number of elements
    */
-  size_type max_size() const noexcept { return N; }
+  constexpr size_type max_size() const noexcept { return N; }
 
   /**
    * @brief Assigns the value to all elements in the container.
    * @param  value: the value to assign to the elements
    */
-  void fill(const T &value) noexcept {
-    for (iterator it = begin(); it != end(); ++it) {
-      *it = value;
-    }
+  constexpr void fill(const T &value) noexcept {
+    ::estd::detail::fill_n(begin(), N, value, ::estd::detail::is_bytewise_fillable<T>{});
   }
 
   /**
@@ -121,22 +224,19 @@ public:
    * associate with the other container.
    * @param  other: container to exchange the contents with
    */
-  void swap(Array &other) noexcept {
-    pointer temp = &data_[0];
-    data_ = other.data_;
-    other = temp;
-  }
+  constexpr void swap(Array &other) noexcept { ::estd::detail::swap_n(begin(), other.begin(), N); }
 
 private:
-  template <class _Tp, class... _Args> void init(size_type index, _Tp value, _Args... args) noexcept {
-    static_assert(::estd::is_same<typename ::estd::remove_cvref<_Tp>::type, value_type>::value,
-                  "initialized type does not match Array type");
-    data_[index] = value;
-    init(index + 1, args...);
+  template <::estd::size_t... _Indexes, class... _Args>
+  constexpr Array(::estd::index_sequence<_Indexes...>, _Args const &...args)
+      : data_{make_element(_Indexes, args...)...} {}
+  // the prvalue result initializes the element, C++17 guarantees no copy while C++14 only allows it to be elided.
+  // The caller is constrained on is_constructible, so a single argument never acts as a C style cast
+  template <class... _Args> static constexpr value_type make_element(::estd::size_t, _Args const &...args) {
+    return value_type(args...);
   }
-  template <class _Tp, class... _Args> void init(size_type index, _Tp value) noexcept { data_[index] = value; }
 
-  void check(size_type pos) const noexcept {
+  constexpr void check(size_type pos) const noexcept {
     if (pos >= N) {
       ::estd::abort();
     }
@@ -146,63 +246,83 @@ private:
   value_type data_[N];
 };
 
-template <class T, ::estd::size_t N> bool operator==(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
-  for (typename Array<T, N>::size_type i = 0; i < N; ++i) {
-    if (lhs[i] != rhs[i]) {
-      return false;
-    }
-  }
-  return true;
+template <class T, ::estd::size_t N>
+constexpr bool operator==(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+  return ::estd::detail::equal_n(lhs.data(), rhs.data(), N, ::estd::detail::is_bitwise_equality_comparable<T>{});
 }
-template <class T, ::estd::size_t N> bool operator!=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+template <class T, ::estd::size_t N>
+constexpr bool operator!=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
   return !(lhs == rhs);
 }
-template <class T, ::estd::size_t N> bool operator<(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
-  for (typename Array<T, N>::size_type i = 0; i < N; ++i) {
-    if (lhs[i] >= rhs[i]) {
-      return false;
-    }
-  }
-  return true;
+/**
+ * @brief compares the contents of lhs and rhs lexicographically
+ */
+template <class T, ::estd::size_t N> constexpr bool operator<(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+  return ::estd::detail::less_n(lhs.data(), rhs.data(), N, ::estd::detail::is_bitwise_lexicographical_comparable<T>{});
 }
-template <class T, ::estd::size_t N> bool operator>(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
-  for (typename Array<T, N>::size_type i = 0; i < N; ++i) {
-    if (lhs[i] <= rhs[i]) {
-      return false;
-    }
-  }
-  return true;
+template <class T, ::estd::size_t N> constexpr bool operator>(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+  return rhs < lhs;
 }
-template <class T, ::estd::size_t N> bool operator>=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+template <class T, ::estd::size_t N>
+constexpr bool operator>=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
   return !(lhs < rhs);
 }
-template <class T, ::estd::size_t N> bool operator<=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
-  return !(lhs > rhs);
+template <class T, ::estd::size_t N>
+constexpr bool operator<=(const Array<T, N> &lhs, const Array<T, N> &rhs) noexcept {
+  return !(rhs < lhs);
 }
 
-template <::estd::size_t I, class T, ::estd::size_t N> T &get(Array<T, N> &a) noexcept {
+template <::estd::size_t I, class T, ::estd::size_t N> constexpr T &get(Array<T, N> &a) noexcept {
   static_assert(I < N, "I must be an integer value in range [0, N).");
   return a[I];
 }
-template <::estd::size_t I, class T, ::estd::size_t N> T &&get(Array<T, N> &&a) noexcept {
+template <::estd::size_t I, class T, ::estd::size_t N> constexpr T &&get(Array<T, N> &&a) noexcept {
   static_assert(I < N, "I must be an integer value in range [0, N).");
-  return a[I];
+  return ::estd::move(a[I]);
 }
-template <::estd::size_t I, class T, ::estd::size_t N> T const &get(Array<T, N> const &a) noexcept {
+template <::estd::size_t I, class T, ::estd::size_t N> constexpr T const &get(Array<T, N> const &a) noexcept {
   static_assert(I < N, "I must be an integer value in range [0, N).");
   return a[I];
 }
-template <::estd::size_t I, class T, ::estd::size_t N> T const &&get(Array<T, N> const &&a) noexcept {
+template <::estd::size_t I, class T, ::estd::size_t N> constexpr T const &&get(Array<T, N> const &&a) noexcept {
   static_assert(I < N, "I must be an integer value in range [0, N).");
-  return a[I];
+  return ::estd::move(a[I]);
 }
 
-template <class T, ::estd::size_t N> void swap(Array<T, N> &lhs, Array<T, N> &rhs) noexcept { lhs.swap(rhs); }
+template <class T, ::estd::size_t N> constexpr void swap(Array<T, N> &lhs, Array<T, N> &rhs) noexcept {
+  lhs.swap(rhs);
+}
 
+/**
+ * @brief creates Array from values, every element is copy or move constructed once from its argument
+ */
 template <class V, class... T>
-Array<typename ::estd::remove_reference<V>::type, sizeof...(T) + 1> to_array(V &&v, T &&...t) {
-  return Array<typename ::estd::remove_reference<V>::type, sizeof...(T) + 1>{::estd::forward<V>(v),
-                                                                             ::estd::forward<T>(t)...};
+constexpr Array<typename ::estd::remove_cvref<V>::type, sizeof...(T) + 1> to_array(V &&v, T &&...t) {
+  return Array<typename ::estd::remove_cvref<V>::type, sizeof...(T) + 1>{::estd::forward<V>(v),
+                                                                         ::estd::forward<T>(t)...};
+}
+
+namespace detail {
+
+template <class T, ::estd::size_t N, ::estd::size_t... I>
+constexpr Array<typename ::estd::remove_cv<T>::type, N> to_array(T (&a)[N], ::estd::index_sequence<I...>) {
+  return Array<typename ::estd::remove_cv<T>::type, N>{a[I]...};
+}
+template <class T, ::estd::size_t N, ::estd::size_t... I>
+constexpr Array<typename ::estd::remove_cv<T>::type, N> to_array(T (&&a)[N], ::estd::index_sequence<I...>) {
+  return Array<typename ::estd::remove_cv<T>::type, N>{::estd::move(a[I])...};
+}
+
+}; // namespace detail
+
+/**
+ * @brief creates Array from built-in array, elements are copied or moved once
+ */
+template <class T, ::estd::size_t N> constexpr Array<typename ::estd::remove_cv<T>::type, N> to_array(T (&a)[N]) {
+  return ::estd::detail::to_array(a, ::estd::make_index_sequence<N>{});
+}
+template <class T, ::estd::size_t N> constexpr Array<typename ::estd::remove_cv<T>::type, N> to_array(T (&&a)[N]) {
+  return ::estd::detail::to_array(::estd::move(a), ::estd::make_index_sequence<N>{});
 }
 
 }; // namespace estd
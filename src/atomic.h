@@ -0,0 +1,147 @@
+/**
+ * @File Name: atomic.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__atomic__
+#define __estd__atomic__
+
+#include "config.h"
+#include "type.h"
+
+namespace estd {
+
+/**
+ * @brief minimum offset between two objects to avoid false sharing
+ */
+constexpr ::estd::size_t hardware_destructive_interference_size = ESTD_CACHE_LINE_SIZE;
+
+enum class memory_order : int {
+  relaxed = __ATOMIC_RELAXED,
+  consume = __ATOMIC_CONSUME,
+  acquire = __ATOMIC_ACQUIRE,
+  release = __ATOMIC_RELEASE,
+  acq_rel = __ATOMIC_ACQ_REL,
+  seq_cst = __ATOMIC_SEQ_CST,
+};
+
+constexpr ::estd::memory_order memory_order_relaxed = ::estd::memory_order::relaxed;
+constexpr ::estd::memory_order memory_order_consume = ::estd::memory_order::consume;
+constexpr ::estd::memory_order memory_order_acquire = ::estd::memory_order::acquire;
+constexpr ::estd::memory_order memory_order_release = ::estd::memory_order::release;
+constexpr ::estd::memory_order memory_order_acq_rel = ::estd::memory_order::acq_rel;
+constexpr ::estd::memory_order memory_order_seq_cst = ::estd::memory_order::seq_cst;
+
+/**
+ * @brief establishes memory synchronization ordering of non-atomic and relaxed atomic accesses
+ * @param  order: the memory ordering executed by this fence
+ */
+inline void atomic_thread_fence(::estd::memory_order order) noexcept { __atomic_thread_fence(static_cast<int>(order)); }
+/**
+ * @brief establishes memory synchronization ordering between a thread and a signal handler (or interrupt) executed on
+ * the same thread
+ * @param  order: the memory ordering executed by this fence
+ */
+inline void atomic_signal_fence(::estd::memory_order order) noexcept { __atomic_signal_fence(static_cast<int>(order)); }
+
+/**
+ * @brief atomic object of integral or pointer type T
+ * @tparam T value type
+ */
+template <class T> class Atomic {
+public:
+  using value_type = T;
+
+  Atomic() noexcept : value_{} {}
+  constexpr explicit Atomic(T desired) noexcept : value_{desired} {}
+  Atomic(Atomic const &) = delete;
+  Atomic &operator=(Atomic const &) = delete;
+
+  /**
+   * @brief checks if the atomic object is lock-free
+   */
+  bool is_lock_free() const noexcept { return __atomic_is_lock_free(sizeof(T), &value_); }
+
+  /**
+   * @brief atomically obtains the value of the atomic object
+   * @param  order: memory order constraints to enforce
+   * @return T: current value
+   */
+  T load(::estd::memory_order order = ::estd::memory_order_seq_cst) const noexcept {
+    return __atomic_load_n(&value_, static_cast<int>(order));
+  }
+  /**
+   * @brief atomically replaces the value of the atomic object with desired
+   * @param  desired: value to store
+   * @param  order: memory order constraints to enforce
+   */
+  void store(T desired, ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    __atomic_store_n(&value_, desired, static_cast<int>(order));
+  }
+  /**
+   * @brief atomically replaces the value of the atomic object and obtains the value held previously
+   * @param  desired: value to store
+   * @param  order: memory order constraints to enforce
+   * @return T: value before the call
+   */
+  T exchange(T desired, ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    return __atomic_exchange_n(&value_, desired, static_cast<int>(order));
+  }
+  /**
+   * @brief atomically compares the value with expected, replaces it with desired if equal, otherwise loads it into
+   * expected. Weak form may fail spuriously.
+   * @return true: value was replaced
+   * @return false: value was loaded into expected
+   */
+  bool compare_exchange_weak(T &expected, T desired, ::estd::memory_order success,
+                             ::estd::memory_order failure) noexcept {
+    return __atomic_compare_exchange_n(&value_, &expected, desired, true, static_cast<int>(success),
+                                       static_cast<int>(failure));
+  }
+  bool compare_exchange_weak(T &expected, T desired,
+                             ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    return compare_exchange_weak(expected, desired, order, failure_order(order));
+  }
+  /**
+   * @brief atomically compares the value with expected, replaces it with desired if equal, otherwise loads it into
+   * expected.
+   * @return true: value was replaced
+   * @return false: value was loaded into expected
+   */
+  bool compare_exchange_strong(T &expected, T desired, ::estd::memory_order success,
+                               ::estd::memory_order failure) noexcept {
+    return __atomic_compare_exchange_n(&value_, &expected, desired, false, static_cast<int>(success),
+                                       static_cast<int>(failure));
+  }
+  bool compare_exchange_strong(T &expected, T desired,
+                               ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    return compare_exchange_strong(expected, desired, order, failure_order(order));
+  }
+  /**
+   * @brief atomically adds arg to the value and obtains the value held previously, T must be integral
+   */
+  T fetch_add(T arg, ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    return __atomic_fetch_add(&value_, arg, static_cast<int>(order));
+  }
+  /**
+   * @brief atomically subtracts arg from the value and obtains the value held previously, T must be integral
+   */
+  T fetch_sub(T arg, ::estd::memory_order order = ::estd::memory_order_seq_cst) noexcept {
+    return __atomic_fetch_sub(&value_, arg, static_cast<int>(order));
+  }
+
+private:
+  static constexpr ::estd::memory_order failure_order(::estd::memory_order order) noexcept {
+    return order == ::estd::memory_order_acq_rel   ? ::estd::memory_order_acquire
+           : order == ::estd::memory_order_release ? ::estd::memory_order_relaxed
+                                                   : order;
+  }
+
+  T value_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,137 @@
+/**
+ * @File Name: charconv.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__charconv__
+#define __estd__charconv__
+
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+namespace detail {
+
+constexpr char kDigitPairs[201] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+template <class U> constexpr ::estd::size_t count_digits(U value) noexcept {
+  ::estd::size_t count = 1U;
+  for (; value >= 100U; value = static_cast<U>(value / 100U)) {
+    count += 2U;
+  }
+  return value >= 10U ? count + 1U : count;
+}
+
+// writes value backwards ending at last, two digits per division
+template <class U> void write_digits(char *last, U value) noexcept {
+  while (value >= 100U) {
+    ::estd::size_t const pair = static_cast<::estd::size_t>(value % 100U) * 2U;
+    value = static_cast<U>(value / 100U);
+    *--last = ::estd::detail::kDigitPairs[pair + 1U];
+    *--last = ::estd::detail::kDigitPairs[pair];
+  }
+  if (value >= 10U) {
+    ::estd::size_t const pair = static_cast<::estd::size_t>(value) * 2U;
+    *--last = ::estd::detail::kDigitPairs[pair + 1U];
+    *--last = ::estd::detail::kDigitPairs[pair];
+  } else {
+    *--last = static_cast<char>('0' + value);
+  }
+}
+
+// parses decimal digits not greater than limit, nullptr if there is no digit or the value exceeds limit
+template <class U> char const *parse_digits(char const *first, char const *last, U limit, U &value) noexcept {
+  char const *const begin = first;
+  U result = 0U;
+  for (; first != last && static_cast<unsigned char>(*first - '0') < 10U; ++first) {
+    U const digit = static_cast<U>(*first - '0');
+    if (result > static_cast<U>((limit - digit) / 10U)) {
+      return nullptr;
+    }
+    result = static_cast<U>(result * 10U + digit);
+  }
+  if (first == begin) {
+    return nullptr;
+  }
+  value = result;
+  return first;
+}
+
+template <class T> constexpr bool is_negative(T value, ::estd::true_type) noexcept { return value < 0; }
+template <class T> constexpr bool is_negative(T, ::estd::false_type) noexcept { return false; }
+
+template <class T>
+struct is_char_convertible
+    : ::estd::integral_constant<bool, ::estd::is_integral<T>::value &&
+                                          !::estd::is_same<typename ::estd::remove_cv<T>::type, bool>::value> {};
+
+}; // namespace detail
+
+/**
+ * @brief writes value in decimal to [first, last) without a terminating null character
+ * @param  first: begin of the output buffer
+ * @param  last: end of the output buffer
+ * @param  value: integer to convert
+ * @return char*: one past the last written character, nullptr if the buffer is too small and nothing is written
+ */
+template <class T> char *to_chars(char *first, char *last, T value) noexcept {
+  static_assert(::estd::detail::is_char_convertible<T>::value, "to_chars requires an integer type");
+  using U = typename ::estd::make_unsigned<T>::type;
+  U magnitude = static_cast<U>(value);
+  bool const negative = ::estd::detail::is_negative(value, ::estd::is_signed<T>{});
+  if (negative) {
+    magnitude = static_cast<U>(0U - magnitude);
+  }
+  ::estd::size_t const length = ::estd::detail::count_digits(magnitude) + (negative ? 1U : 0U);
+  if (static_cast<::estd::size_t>(last - first) < length) {
+    return nullptr;
+  }
+  if (negative) {
+    *first = '-';
+  }
+  ::estd::detail::write_digits(first + length, magnitude);
+  return first + length;
+}
+
+/**
+ * @brief parses a decimal integer at the beginning of [first, last), a leading '-' is accepted for signed types
+ * @param  first: begin of the text
+ * @param  last: end of the text
+ * @param  value: receives the parsed integer, unchanged on failure
+ * @return char const*: one past the last parsed character, nullptr if there is no digit or the value is out of range
+ */
+template <class T> char const *from_chars(char const *first, char const *last, T &value) noexcept {
+  static_assert(::estd::detail::is_char_convertible<T>::value, "from_chars requires an integer type");
+  using U = typename ::estd::make_unsigned<T>::type;
+  U const max = static_cast<U>(::estd::is_signed<T>::value ? static_cast<U>(~U{0U}) >> 1U : static_cast<U>(~U{0U}));
+  U magnitude = 0U;
+  if (::estd::is_signed<T>::value && first != last && *first == '-') {
+    char const *const end = ::estd::detail::parse_digits(first + 1, last, static_cast<U>(max + 1U), magnitude);
+    if (end != nullptr) {
+      // -(magnitude - 1) - 1 does not overflow for the minimum value
+      value = magnitude == 0U ? T{0} : static_cast<T>(-static_cast<T>(magnitude - 1U) - 1);
+    }
+    return end;
+  }
+  char const *const end = ::estd::detail::parse_digits(first, last, max, magnitude);
+  if (end != nullptr) {
+    value = static_cast<T>(magnitude);
+  }
+  return end;
+}
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,18 @@
+/**
+ * @File Name: config.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__config__
+#define __estd__config__
+
+/**
+ * @brief size of cache line, used to separate data written by different cores. Override it for the target.
+ */
+#ifndef ESTD_CACHE_LINE_SIZE
+#define ESTD_CACHE_LINE_SIZE 64
+#endif
+
+#endif
@@ -0,0 +1,416 @@
+/**
+ * @File Name: flat_map.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__flat_map__
+#define __estd__flat_map__
+
+#include "abort.h"
+#include "algorithm.h"
+#include "array.h"
+#include "config.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief storage order of keys in FlatMap and FlatSet
+ */
+enum class FlatLayout : int {
+  /**
+   * @brief keys are sorted, supports insert and erase by shifting
+   */
+  sorted,
+  /**
+   * @brief keys are stored in BFS order of an implicit binary search tree. Lookup touches fewer cache lines and
+   * prefetches the next levels, but content can only be replaced by build_from_unsorted
+   */
+  eytzinger,
+};
+
+namespace detail {
+
+// smallest unsigned integer type which can index N elements
+template <::estd::size_t N>
+using flat_index_t = typename ::estd::conditional<
+    (N < 0xFFU), unsigned char,
+    typename ::estd::conditional<(N < 0xFFFFU), unsigned short,
+                                 typename ::estd::conditional<(N < 0xFFFFFFFFU), unsigned int,
+                                                              ::estd::size_t>::type>::type>::type;
+
+// reorders slots so that new slot i holds old slot order[i], order is reset to identity
+template <class Index, class SwapSlot> void gather_permute(Index *order, ::estd::size_t size, SwapSlot swap_slot) {
+  for (::estd::size_t i = 0U; i < size; ++i) {
+    ::estd::size_t current = i;
+    while (order[current] != i) {
+      ::estd::size_t const next = order[current];
+      swap_slot(current, next);
+      order[current] = static_cast<Index>(current);
+      current = next;
+    }
+    order[current] = static_cast<Index>(current);
+  }
+}
+
+// writes the sorted rank of every slot of BFS layout, returns the next rank
+template <class Index>
+::estd::size_t eytzinger_order(Index *order, ::estd::size_t size, ::estd::size_t slot, ::estd::size_t rank) noexcept {
+  if (slot >= size) {
+    return rank;
+  }
+  rank = ::estd::detail::eytzinger_order(order, size, 2U * slot + 1U, rank);
+  order[slot] = static_cast<Index>(rank);
+  return ::estd::detail::eytzinger_order(order, size, 2U * slot + 2U, rank + 1U);
+}
+
+/**
+ * @brief sorted key storage shared by FlatMap and FlatSet. Derived class keeps the parallel arrays and provides
+ * swap_slot(i, j) and move_slot(to, from) which apply to all of them.
+ */
+template <class Derived, class K, ::estd::size_t N, class Compare, ::estd::FlatLayout Layout> class FlatBase {
+public:
+  using key_type = K;
+  using size_type = ::estd::size_t;
+  using key_compare = Compare;
+  /**
+   * @brief smallest unsigned integer which can index N elements, element type of the build_from_unsorted scratch
+   */
+  using index_type = ::estd::detail::flat_index_t<N>;
+
+  /**
+   * @brief index returned by search functions when key is not found
+   */
+  static constexpr size_type npos = N;
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  static constexpr size_type capacity() noexcept { return N; }
+  void clear() noexcept { size_ = 0U; }
+
+  /**
+   * @brief returns the keys in storage order, sorted or BFS order depending on Layout
+   */
+  K const *keys() const noexcept { return keys_.data(); }
+  K const &key_at(size_type index) const noexcept { return keys_[index]; }
+
+  /**
+   * @brief checks if there is an element with key equivalent to key
+   */
+  bool contains(K const &key) const noexcept { return index_of(key) != npos; }
+  /**
+   * @brief returns the storage index of key in O(log n), npos if key is not found
+   */
+  size_type index_of(K const &key) const noexcept {
+    return search(key, ::estd::integral_constant<FlatLayout, Layout>{});
+  }
+
+protected:
+  using sorted_tag = ::estd::integral_constant<FlatLayout, FlatLayout::sorted>;
+  using eytzinger_tag = ::estd::integral_constant<FlatLayout, FlatLayout::eytzinger>;
+
+  FlatBase() noexcept : keys_{}, size_{0U} {}
+
+  size_type lower_bound_index(K const &key) const noexcept {
+    return static_cast<size_type>(::estd::lower_bound(keys_.begin(), keys_.begin() + size_, key, Compare{}) -
+                                  keys_.begin());
+  }
+
+  // opens slot pos by shifting the following elements to the right, abort when full
+  void insert_slot(size_type pos) noexcept {
+    static_assert(Layout == FlatLayout::sorted, "insert is only supported by sorted layout");
+    if (size_ == N) {
+      ::estd::abort();
+    }
+    for (size_type i = size_; i > pos; --i) {
+      derived().move_slot(i, i - 1U);
+    }
+    ++size_;
+  }
+  // closes slot pos by shifting the following elements to the left
+  void erase_slot(size_type pos) noexcept {
+    static_assert(Layout == FlatLayout::sorted, "erase is only supported by sorted layout");
+    for (size_type i = pos + 1U; i < size_; ++i) {
+      derived().move_slot(i - 1U, i);
+    }
+    --size_;
+  }
+
+  // sorts the first count slots which have been filled by derived, removes duplicated keys keeping the first one
+  // and lays them out. order holds the permutation, at least count elements
+  void build(size_type count, index_type *order) noexcept {
+    if (count > N) {
+      ::estd::abort();
+    }
+    for (size_type i = 0U; i < count; ++i) {
+      order[i] = static_cast<index_type>(i);
+    }
+    K const *const keys = keys_.data();
+    ::estd::sort(order, order + count, [keys](index_type lhs, index_type rhs) {
+      Compare const comp{};
+      return comp(keys[lhs], keys[rhs]) || (!comp(keys[rhs], keys[lhs]) && lhs < rhs);
+    });
+    ::estd::detail::gather_permute(order, count, [this](size_type i, size_type j) { derived().swap_slot(i, j); });
+
+    size_type unique = 0U;
+    for (size_type i = 0U; i < count; ++i) {
+      if (unique == 0U || Compare{}(keys_[unique - 1U], keys_[i])) {
+        if (unique != i) {
+          derived().move_slot(unique, i);
+        }
+        ++unique;
+      }
+    }
+    size_ = unique;
+    layout(order, ::estd::integral_constant<bool, Layout == FlatLayout::eytzinger>{});
+  }
+
+  K &key_slot(size_type index) noexcept { return keys_[index]; }
+
+private:
+  Derived &derived() noexcept { return static_cast<Derived &>(*this); }
+
+  void layout(index_type *, ::estd::false_type) noexcept {}
+  void layout(index_type *order, ::estd::true_type) noexcept {
+    ::estd::detail::eytzinger_order(order, size_, 0U, 0U);
+    ::estd::detail::gather_permute(order, size_, [this](size_type i, size_type j) { derived().swap_slot(i, j); });
+  }
+
+  size_type search(K const &key, sorted_tag) const noexcept {
+    size_type const index = lower_bound_index(key);
+    return index != size_ && !Compare{}(key, keys_[index]) ? index : npos;
+  }
+  size_type search(K const &key, eytzinger_tag) const noexcept {
+    // descendants of node k four levels down are in one cache line for 4 byte keys
+    constexpr size_type kStride = sizeof(K) >= ESTD_CACHE_LINE_SIZE ? 1U : ESTD_CACHE_LINE_SIZE / sizeof(K);
+    Compare const comp{};
+    K const *const keys = keys_.data();
+    size_type k = 1U;
+    while (k <= size_) {
+      // integer arithmetic, the prefetched address may be past the end of keys
+      __builtin_prefetch(reinterpret_cast<void const *>(reinterpret_cast<::estd::uintptr_t>(keys) +
+                                                        (k * kStride - 1U) * sizeof(K)));
+      k = 2U * k + (comp(keys[k - 1U], key) ? 1U : 0U);
+    }
+    // the lower bound is the last node where search went left, drop the trailing right turns and that left turn
+    k >>= __builtin_ffsll(static_cast<long long>(~static_cast<unsigned long long>(k)));
+    return k != 0U && !comp(key, keys[k - 1U]) ? k - 1U : npos;
+  }
+
+  ::estd::Array<K, N> keys_;
+  size_type size_;
+};
+
+template <class Derived, class K, ::estd::size_t N, class Compare, ::estd::FlatLayout Layout>
+constexpr typename FlatBase<Derived, K, N, Compare, Layout>::size_type FlatBase<Derived, K, N, Compare, Layout>::npos;
+
+}; // namespace detail
+
+/**
+ * @brief set of unique keys stored in one fixed size Array. Lookup is branchless binary search in O(log n), insert and
+ * erase shift elements in O(n). Prefer build_from_unsorted to fill many keys at once.
+ * @tparam K key type
+ * @tparam N capacity
+ * @tparam Compare stateless comparison function object
+ * @tparam Layout storage order of keys
+ */
+template <class K, ::estd::size_t N, class Compare = ::estd::less,
+          ::estd::FlatLayout Layout = ::estd::FlatLayout::sorted>
+class FlatSet : public ::estd::detail::FlatBase<FlatSet<K, N, Compare, Layout>, K, N, Compare, Layout> {
+  using Base = ::estd::detail::FlatBase<FlatSet<K, N, Compare, Layout>, K, N, Compare, Layout>;
+
+public:
+  using value_type = K;
+  using size_type = ::estd::size_t;
+
+  /**
+   * @brief inserts key if it does not exist, abort when full
+   * @param  key: key to insert
+   * @return bool: true if key is inserted, false if key already exists
+   */
+  bool insert(K const &key) noexcept {
+    size_type const pos = this->lower_bound_index(key);
+    if (pos != this->size() && !Compare{}(key, this->key_at(pos))) {
+      return false;
+    }
+    this->insert_slot(pos);
+    this->key_slot(pos) = key;
+    return true;
+  }
+  /**
+   * @brief removes key
+   * @return size_type: number of removed elements, 0 or 1
+   */
+  size_type erase(K const &key) noexcept {
+    size_type const pos = this->index_of(key);
+    if (pos == Base::npos) {
+      return 0U;
+    }
+    this->erase_slot(pos);
+    return 1U;
+  }
+
+  /**
+   * @brief replaces content with count keys which may be unsorted and duplicated, sorts once in O(n log n). The
+   * permutation is kept in scratch, nothing proportional to count is placed on the stack.
+   * @param  keys: keys to insert
+   * @param  count: number of keys, abort when larger than N
+   * @param  scratch: buffer of at least count indices, its content is unspecified after build
+   */
+  void build_from_unsorted(K const *keys, size_type count, typename Base::index_type *scratch) noexcept {
+    for (size_type i = 0U; i < count && i < N; ++i) {
+      this->key_slot(i) = keys[i];
+    }
+    this->build(count, scratch);
+  }
+
+private:
+  friend Base;
+  void swap_slot(size_type i, size_type j) noexcept { ::estd::swap(this->key_slot(i), this->key_slot(j)); }
+  void move_slot(size_type to, size_type from) noexcept { this->key_slot(to) = ::estd::move(this->key_slot(from)); }
+};
+
+/**
+ * @brief associative container with unique keys stored as parallel fixed size Arrays of keys and values, so lookup
+ * only touches keys. Lookup is branchless binary search in O(log n), insert and erase shift elements in O(n). Prefer
+ * build_from_unsorted to fill many elements at once.
+ * @tparam K key type
+ * @tparam V mapped type
+ * @tparam N capacity
+ * @tparam Compare stateless comparison function object
+ * @tparam Layout storage order of keys
+ */
+template <class K, class V, ::estd::size_t N, class Compare = ::estd::less,
+          ::estd::FlatLayout Layout = ::estd::FlatLayout::sorted>
+class FlatMap : public ::estd::detail::FlatBase<FlatMap<K, V, N, Compare, Layout>, K, N, Compare, Layout> {
+  using Base = ::estd::detail::FlatBase<FlatMap<K, V, N, Compare, Layout>, K, N, Compare, Layout>;
+
+public:
+  using mapped_type = V;
+  using size_type = ::estd::size_t;
+
+  FlatMap() noexcept : Base{}, values_{} {}
+
+  /**
+   * @brief returns the values in the same order as keys()
+   */
+  V const *values() const noexcept { return values_.data(); }
+  V &value_at(size_type index) noexcept { return values_[index]; }
+  V const &value_at(size_type index) const noexcept { return values_[index]; }
+
+  /**
+   * @brief returns the value mapped to key, nullptr if key is not found
+   */
+  V *find(K const &key) noexcept {
+    size_type const index = this->index_of(key);
+    return index == Base::npos ? nullptr : &values_[index];
+  }
+  V const *find(K const &key) const noexcept {
+    size_type const index = this->index_of(key);
+    return index == Base::npos ? nullptr : &values_[index];
+  }
+  /**
+   * @brief returns the value mapped to key, abort if key is not found
+   */
+  V &at(K const &key) noexcept {
+    V *const value = find(key);
+    if (value == nullptr) {
+      ::estd::abort();
+    }
+    return *value;
+  }
+  V const &at(K const &key) const noexcept {
+    V const *const value = find(key);
+    if (value == nullptr) {
+      ::estd::abort();
+    }
+    return *value;
+  }
+
+  /**
+   * @brief inserts key and value if key does not exist, abort when full
+   * @return bool: true if inserted, false if key already exists and value is not changed
+   */
+  bool insert(K const &key, V const &value) noexcept { return emplace(key, value, false); }
+  /**
+   * @brief inserts key and value, or assigns value if key exists, abort when full
+   * @return bool: true if inserted, false if assigned
+   */
+  bool insert_or_assign(K const &key, V const &value) noexcept { return emplace(key, value, true); }
+  /**
+   * @brief returns the value mapped to key, inserts a value initialized one if key does not exist
+   */
+  V &operator[](K const &key) noexcept {
+    size_type const pos = this->lower_bound_index(key);
+    if (pos == this->size() || Compare{}(key, this->key_at(pos))) {
+      this->insert_slot(pos);
+      this->key_slot(pos) = key;
+      values_[pos] = V{};
+    }
+    return values_[pos];
+  }
+  /**
+   * @brief removes the element with key
+   * @return size_type: number of removed elements, 0 or 1
+   */
+  size_type erase(K const &key) noexcept {
+    size_type const pos = this->index_of(key);
+    if (pos == Base::npos) {
+      return 0U;
+    }
+    this->erase_slot(pos);
+    return 1U;
+  }
+
+  /**
+   * @brief replaces content with count elements which may be unsorted, sorts once in O(n log n). For duplicated keys
+   * the first one is kept. The permutation is kept in scratch, nothing proportional to count is placed on the stack.
+   * @param  keys: keys of elements
+   * @param  values: values of elements
+   * @param  count: number of elements, abort when larger than N
+   * @param  scratch: buffer of at least count indices, its content is unspecified after build
+   */
+  void build_from_unsorted(K const *keys, V const *values, size_type count,
+                           typename Base::index_type *scratch) noexcept {
+    for (size_type i = 0U; i < count && i < N; ++i) {
+      this->key_slot(i) = keys[i];
+      values_[i] = values[i];
+    }
+    this->build(count, scratch);
+  }
+
+private:
+  friend Base;
+  void swap_slot(size_type i, size_type j) noexcept {
+    ::estd::swap(this->key_slot(i), this->key_slot(j));
+    ::estd::swap(values_[i], values_[j]);
+  }
+  void move_slot(size_type to, size_type from) noexcept {
+    this->key_slot(to) = ::estd::move(this->key_slot(from));
+    values_[to] = ::estd::move(values_[from]);
+  }
+
+  bool emplace(K const &key, V const &value, bool assign) noexcept {
+    size_type const pos = this->lower_bound_index(key);
+    if (pos != this->size() && !Compare{}(key, this->key_at(pos))) {
+      if (assign) {
+        values_[pos] = value;
+      }
+      return false;
+    }
+    this->insert_slot(pos);
+    this->key_slot(pos) = key;
+    values_[pos] = value;
+    return true;
+  }
+
+  ::estd::Array<V, N> values_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,79 @@
+/**
+ * @File Name: hash.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__hash__
+#define __estd__hash__
+
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+/**
+ * @brief mixes all bits of value into all bits of the result, finalizer of splitmix64
+ */
+constexpr unsigned long long hash_mix(unsigned long long value) noexcept {
+  value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+  return value ^ (value >> 31U);
+}
+
+/**
+ * @brief hashes count bytes by FNV-1a
+ */
+inline ::estd::size_t hash_bytes(void const *data, ::estd::size_t count) noexcept {
+  unsigned char const *const bytes = static_cast<unsigned char const *>(data);
+  unsigned long long hash = 0xCBF29CE484222325ULL;
+  for (::estd::size_t i = 0U; i < count; ++i) {
+    hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+  }
+  return static_cast<::estd::size_t>(hash);
+}
+
+namespace detail {
+
+// smallest power of two which is not less than value
+constexpr ::estd::size_t bit_ceil(::estd::size_t value) noexcept {
+  ::estd::size_t result = 1U;
+  while (result < value) {
+    result <<= 1U;
+  }
+  return result;
+}
+// number of bits needed to represent value
+constexpr ::estd::size_t bit_width(::estd::size_t value) noexcept {
+  ::estd::size_t width = 0U;
+  while (value != 0U) {
+    value >>= 1U;
+    ++width;
+  }
+  return width;
+}
+
+template <class T, bool = ::estd::is_integral<T>::value> struct HashImpl {};
+template <class T> struct HashImpl<T, true> {
+  ::estd::size_t operator()(T value) const noexcept {
+    return static_cast<::estd::size_t>(::estd::hash_mix(static_cast<unsigned long long>(value)));
+  }
+};
+template <class T> struct HashImpl<T *, false> {
+  ::estd::size_t operator()(T *value) const noexcept {
+    return static_cast<::estd::size_t>(::estd::hash_mix(reinterpret_cast<::estd::uintptr_t>(value)));
+  }
+};
+
+}; // namespace detail
+
+/**
+ * @brief hash function object. Integers and pointers are mixed so that all bits of the result depend on all bits of
+ * value, which makes low and high bits both usable by power of two tables. Specialize it for other types.
+ */
+template <class T> struct hash : ::estd::detail::HashImpl<typename ::estd::remove_cv<T>::type> {};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,212 @@
+/**
+ * @File Name: intrusive_forward_list.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_forward_list__
+#define __estd__intrusive_forward_list__
+
+#include "intrusive_traits.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+template <class Node> class IntrusiveForwardList;
+namespace detail {
+template <class Node> class ForwardIterator;
+};
+
+/**
+ * @brief node of intrusive singly linked list, embedded in element.
+ * @tparam T element type
+ * @tparam GetNode stateless functor converting element pointer to node pointer
+ * @tparam GetElement stateless functor converting node pointer to element pointer
+ */
+template <class T, class GetNode, class GetElement = GetNode> class IntrusiveForwardListNode {
+public:
+  using value_type = T;
+  using reference = value_type &;
+
+  static IntrusiveForwardListNode *get_node(T *const element) noexcept {
+    return static_cast<IntrusiveForwardListNode *>(GetNode{}(element));
+  }
+  static T *get_element(IntrusiveForwardListNode *const node) noexcept { return GetElement{}(node); }
+  static T const *get_element(IntrusiveForwardListNode const *const node) noexcept { return GetElement{}(node); }
+
+  IntrusiveForwardListNode() noexcept : post_{nullptr} {}
+
+  IntrusiveForwardListNode *next() const noexcept { return post_; }
+  reference get_value() noexcept { return *get_element(this); }
+
+protected:
+  friend class IntrusiveForwardList<IntrusiveForwardListNode>;
+  friend class detail::ForwardIterator<IntrusiveForwardListNode>;
+  friend class detail::ForwardIterator<IntrusiveForwardListNode const>;
+  IntrusiveForwardListNode *post_;
+};
+
+namespace detail {
+
+template <class Node> class ForwardIterator {
+public:
+  using size_type = ::estd::size_t;
+  using value_type = typename ::estd::conditional<::estd::is_const<Node>::value, const typename Node::value_type,
+                                                  typename Node::value_type>::type;
+  using pointer = value_type *;
+  using reference = value_type &;
+
+  explicit ForwardIterator(Node *const node_p) : node_p_{node_p} {}
+  ForwardIterator &operator++() noexcept {
+    node_p_ = node_p_->post_;
+    return *this;
+  }
+  ForwardIterator operator++(int) noexcept {
+    ForwardIterator const old = *this;
+    node_p_ = node_p_->post_;
+    return old;
+  }
+  bool operator==(ForwardIterator const &other) const noexcept { return node_p_ == other.node_p_; }
+  bool operator!=(ForwardIterator const &other) const noexcept { return node_p_ != other.node_p_; }
+
+  reference operator*() const noexcept { return *Node::get_element(node_p_); }
+  pointer operator->() const noexcept { return Node::get_element(node_p_); }
+
+private:
+  friend class IntrusiveForwardList<typename ::estd::remove_const<Node>::type>;
+  Node *node_p_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief intrusive singly linked list. It keeps a tail pointer so it can be used as FIFO queue with one pointer per
+ * node.
+ * @tparam Node IntrusiveForwardListNode type
+ */
+template <class Node> class IntrusiveForwardList {
+public:
+  using value_type = typename Node::value_type;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = ::estd::detail::ForwardIterator<Node>;
+  using const_iterator = ::estd::detail::ForwardIterator<Node const>;
+
+  IntrusiveForwardList() noexcept : head_{}, tail_{&head_}, size_{0U} {}
+  IntrusiveForwardList(IntrusiveForwardList const &) = delete;
+  IntrusiveForwardList &operator=(IntrusiveForwardList const &) = delete;
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+
+  /**
+   * @brief returns an iterator to the element before beginning, it can be used by insert_after and erase_after
+   */
+  iterator before_begin() noexcept { return iterator{&head_}; }
+  const_iterator before_begin() const noexcept { return const_iterator{&head_}; }
+  iterator begin() noexcept { return iterator{head_.post_}; }
+  iterator end() noexcept { return iterator{nullptr}; }
+  const_iterator begin() const noexcept { return const_iterator{head_.post_}; }
+  const_iterator end() const noexcept { return const_iterator{nullptr}; }
+
+  /**
+   * @brief access the first element
+   */
+  reference front() noexcept { return *Node::get_element(head_.post_); }
+  const_reference front() const noexcept { return *Node::get_element(head_.post_); }
+  /**
+   * @brief access the last element
+   */
+  reference back() noexcept { return *Node::get_element(tail_); }
+  const_reference back() const noexcept { return *Node::get_element(tail_); }
+
+  /**
+   * @brief Prepends the given element value to the beginning of the container.
+   * @param value the value of the element to prepend
+   */
+  void push_front(reference value) noexcept { insert_after(before_begin(), value); }
+  /**
+   * @brief Appends the given element value to the end of the container in O(1).
+   * @param value the value of the element to append
+   */
+  void push_back(reference value) noexcept {
+    ++size_;
+    Node *const node_p = Node::get_node(&value);
+    node_p->post_ = nullptr;
+    tail_->post_ = node_p;
+    tail_ = node_p;
+  }
+  /**
+   * @brief Removes the first element of the container. If there are no elements in the container, the behavior is
+   * undefined.
+   */
+  void pop_front() noexcept { erase_after(before_begin()); }
+
+  /**
+   * @brief inserts value after pos.
+   * @param pos iterator after which the content will be inserted, may be before_begin()
+   * @param value element value to insert
+   * @return iterator Iterator pointing to the inserted value.
+   */
+  iterator insert_after(iterator pos, reference value) noexcept {
+    ++size_;
+    Node *const node_p = Node::get_node(&value);
+    node_p->post_ = pos.node_p_->post_;
+    pos.node_p_->post_ = node_p;
+    if (tail_ == pos.node_p_) {
+      tail_ = node_p;
+    }
+    return iterator{node_p};
+  }
+  /**
+   * @brief Removes the element following pos.
+   * @param pos iterator to the element preceding the element to remove
+   * @return iterator Iterator following the removed element.
+   */
+  iterator erase_after(iterator pos) noexcept {
+    --size_;
+    Node *const node_p = pos.node_p_->post_;
+    pos.node_p_->post_ = node_p->post_;
+    if (tail_ == node_p) {
+      tail_ = pos.node_p_;
+    }
+    return iterator{pos.node_p_->post_};
+  }
+
+  /**
+   * @brief Removes all elements satisfying p.
+   * @param p unary predicate which returns true if the element should be removed
+   * @return size_type number of removed elements
+   */
+  template <class UnaryPredicate> size_type remove_if(UnaryPredicate p) noexcept {
+    size_type const old_size = size_;
+    iterator prev = before_begin();
+    iterator it = begin();
+    while (it != end()) {
+      if (p(*it)) {
+        it = erase_after(prev);
+      } else {
+        prev = it;
+        ++it;
+      }
+    }
+    return old_size - size_;
+  }
+  size_type remove(const_reference value) noexcept {
+    return remove_if([&value](const_reference element) { return element == value; });
+  }
+
+private:
+  Node head_;
+  Node *tail_;
+  size_type size_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,262 @@
+/**
+ * @File Name: intrusive_hash_table.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_hash_table__
+#define __estd__intrusive_hash_table__
+
+#include "abort.h"
+#include "algorithm.h"
+#include "array.h"
+#include "hash.h"
+#include "intrusive_list.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+namespace detail {
+
+template <class Node, class KeyOf>
+using intrusive_key_t =
+    typename ::estd::remove_cvref<decltype(KeyOf{}(::estd::declval<typename Node::value_type const &>()))>::type;
+
+}; // namespace detail
+
+/**
+ * @brief hash table indexing elements which embed an IntrusiveListNode, elements are never copied. Buckets are list
+ * heads in caller supplied storage, each bucket is a circular list through the nodes of its elements, so an element can
+ * unlink itself by erasing its own node in O(1) without the table. The table keeps no element count for this reason,
+ * size() walks the buckets. Growing is incremental: after rehash every operation moves a few buckets from the old
+ * storage to the new one.
+ * @tparam Node IntrusiveListNode type embedded in element
+ * @tparam KeyOf stateless functor returning key of element
+ * @tparam Hash hash function object, see estd::hash
+ * @tparam KeyEqual key equality function object
+ */
+template <class Node, class KeyOf, class Hash = ::estd::hash<::estd::detail::intrusive_key_t<Node, KeyOf>>,
+          class KeyEqual = ::estd::equal_to>
+class IntrusiveHashTable {
+public:
+  using value_type = typename Node::value_type;
+  using key_type = ::estd::detail::intrusive_key_t<Node, KeyOf>;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using pointer = value_type *;
+  using const_pointer = value_type const *;
+
+  /**
+   * @brief head of the list of one bucket
+   */
+  class Bucket {
+  public:
+    Bucket() noexcept : head_{} { head_.link_self(); }
+    Bucket(Bucket const &) = delete;
+    Bucket &operator=(Bucket const &) = delete;
+
+    bool empty() const noexcept { return head_.next() == &head_; }
+
+  private:
+    friend class IntrusiveHashTable;
+    Node head_;
+  };
+
+  /**
+   * @brief creates table over buckets
+   * @param  buckets: empty bucket storage which must outlive the table or the next rehash
+   * @param  count: number of buckets, must be power of two
+   */
+  IntrusiveHashTable(Bucket *buckets, size_type count) noexcept
+      : buckets_{buckets}, mask_{count - 1U}, old_buckets_{nullptr}, old_mask_{0U}, cursor_{0U} {
+    if (count == 0U || (count & (count - 1U)) != 0U) {
+      ::estd::abort();
+    }
+  }
+  template <::estd::size_t N>
+  explicit IntrusiveHashTable(::estd::Array<Bucket, N> &buckets) noexcept : IntrusiveHashTable{buckets.data(), N} {
+    static_assert(N != 0U && (N & (N - 1U)) == 0U, "bucket count must be power of two");
+  }
+  IntrusiveHashTable(IntrusiveHashTable const &) = delete;
+  IntrusiveHashTable &operator=(IntrusiveHashTable const &) = delete;
+
+  /**
+   * @brief checks if there is no element in O(bucket_count)
+   */
+  bool empty() const noexcept {
+    return count_in(buckets_, mask_, 1U) == 0U && (!rehashing() || count_in(old_buckets_, old_mask_, 1U) == 0U);
+  }
+  /**
+   * @brief returns the number of elements in O(n + bucket_count), elements may have unlinked themselves
+   */
+  size_type size() const noexcept {
+    size_type const count = count_in(buckets_, mask_, kNoLimit);
+    return rehashing() ? count + count_in(old_buckets_, old_mask_, kNoLimit) : count;
+  }
+  size_type bucket_count() const noexcept { return mask_ + 1U; }
+  /**
+   * @brief returns the average number of elements per bucket in O(n + bucket_count)
+   */
+  float load_factor() const noexcept { return static_cast<float>(size()) / static_cast<float>(bucket_count()); }
+
+  /**
+   * @brief returns the element with key in O(1) on average, nullptr if key is not found
+   */
+  pointer find(key_type const &key) noexcept {
+    rehash_step();
+    return find_impl(key, Hash{}(key));
+  }
+
+  /**
+   * @brief inserts element if there is no element with the same key
+   * @param  element: element to insert, its node must not be linked
+   * @return bool: true if inserted
+   */
+  bool insert(reference element) noexcept {
+    rehash_step();
+    key_type const &key = KeyOf{}(element);
+    size_type const hash = Hash{}(key);
+    if (find_impl(key, hash) != nullptr) {
+      return false;
+    }
+    Node::get_node(&element)->insert_after(&buckets_[hash & mask_].head_);
+    return true;
+  }
+  /**
+   * @brief removes element in O(1) without lookup, element must be in this table. Erasing the node of element directly
+   * is equivalent.
+   */
+  void erase(reference element) noexcept {
+    rehash_step();
+    Node::get_node(&element)->erase();
+  }
+  /**
+   * @brief removes the element with key
+   * @return pointer: removed element, nullptr if key is not found
+   */
+  pointer erase(key_type const &key) noexcept {
+    pointer const element = find(key);
+    if (element != nullptr) {
+      Node::get_node(element)->erase();
+    }
+    return element;
+  }
+
+  /**
+   * @brief starts moving elements into new bucket storage. The old storage is used until rehashing() returns false,
+   * every following operation moves a few buckets. A rehash in progress is finished first.
+   * @param  buckets: empty bucket storage
+   * @param  count: number of buckets, must be power of two
+   */
+  void rehash(Bucket *buckets, size_type count) noexcept {
+    if (count == 0U || (count & (count - 1U)) != 0U) {
+      ::estd::abort();
+    }
+    while (rehashing()) {
+      rehash_step();
+    }
+    old_buckets_ = buckets_;
+    old_mask_ = mask_;
+    cursor_ = 0U;
+    buckets_ = buckets;
+    mask_ = count - 1U;
+  }
+  template <::estd::size_t N> void rehash(::estd::Array<Bucket, N> &buckets) noexcept {
+    static_assert(N != 0U && (N & (N - 1U)) == 0U, "bucket count must be power of two");
+    rehash(buckets.data(), N);
+  }
+  /**
+   * @brief checks if elements are still being moved from the old bucket storage
+   */
+  bool rehashing() const noexcept { return old_buckets_ != nullptr; }
+  /**
+   * @brief moves up to count buckets from the old bucket storage, called by every operation
+   */
+  void rehash_step(size_type count = kRehashStep) noexcept {
+    for (; count != 0U && rehashing(); --count) {
+      Node *const head = &old_buckets_[cursor_].head_;
+      while (head->next() != head) {
+        Node *const node = head->next();
+        node->erase();
+        node->insert_after(&buckets_[Hash{}(KeyOf{}(*Node::get_element(node))) & mask_].head_);
+      }
+      if (cursor_ == old_mask_) {
+        old_buckets_ = nullptr;
+      } else {
+        ++cursor_;
+      }
+    }
+  }
+
+  /**
+   * @brief calls fn(element) for every element in unspecified order, fn must not modify the table
+   */
+  template <class Fn> void for_each(Fn &&fn) {
+    for_each_in(buckets_, mask_, fn);
+    if (rehashing()) {
+      for_each_in(old_buckets_, old_mask_, fn);
+    }
+  }
+
+private:
+  static constexpr size_type kRehashStep = 2U;
+  static constexpr size_type kNoLimit = static_cast<size_type>(-1);
+
+  // counts elements in buckets, stops when limit is reached
+  static size_type count_in(Bucket const *buckets, size_type mask, size_type limit) noexcept {
+    size_type count = 0U;
+    for (size_type i = 0U; i <= mask; ++i) {
+      Node const *const head = &buckets[i].head_;
+      for (Node const *node = head->next(); node != head && count != limit; node = node->next()) {
+        ++count;
+      }
+      if (count == limit) {
+        break;
+      }
+    }
+    return count;
+  }
+
+  static pointer find_in(Bucket &bucket, key_type const &key) noexcept {
+    Node *const head = &bucket.head_;
+    for (Node *node = head->next(); node != head; node = node->next()) {
+      pointer const element = Node::get_element(node);
+      if (KeyEqual{}(KeyOf{}(*element), key)) {
+        return element;
+      }
+    }
+    return nullptr;
+  }
+  pointer find_impl(key_type const &key, size_type hash) noexcept {
+    pointer const element = find_in(buckets_[hash & mask_], key);
+    if (element != nullptr || !rehashing() || (hash & old_mask_) < cursor_) {
+      return element;
+    }
+    // bucket has not been moved yet
+    return find_in(old_buckets_[hash & old_mask_], key);
+  }
+
+  template <class Fn> static void for_each_in(Bucket *buckets, size_type mask, Fn &fn) {
+    for (size_type i = 0U; i <= mask; ++i) {
+      Node *const head = &buckets[i].head_;
+      for (Node *node = head->next(); node != head;) {
+        Node *const next = node->next();
+        fn(*Node::get_element(node));
+        node = next;
+      }
+    }
+  }
+
+  Bucket *buckets_;
+  size_type mask_;
+  Bucket *old_buckets_;
+  size_type old_mask_;
+  size_type cursor_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * @File Name: intrusive_index_list.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_index_list__
+#define __estd__intrusive_index_list__
+
+#include "abort.h"
+#include "array.h"
+#include "intrusive_traits.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+template <class T, class NodeTraits, class Index> class IntrusiveIndexList;
+namespace detail {
+template <class T, class NodeTraits, class Index> class IndexIterator;
+};
+
+/**
+ * @brief node of intrusive index list. Links are indices into the storage of elements instead of pointers, so the
+ * node is 2 * sizeof(Index) bytes and stays valid when the storage is copied or mapped to another address.
+ * @tparam Index unsigned integer type of links
+ */
+template <class Index> class IntrusiveIndexListNode {
+public:
+  using index_type = Index;
+
+  /**
+   * @brief index which means no element
+   */
+  static constexpr index_type npos = static_cast<index_type>(~static_cast<index_type>(0));
+
+  IntrusiveIndexListNode() noexcept : prev_{npos}, post_{npos} {}
+
+  index_type prev() const noexcept { return prev_; }
+  index_type next() const noexcept { return post_; }
+
+protected:
+  template <class, class, class> friend class IntrusiveIndexList;
+  template <class, class, class> friend class detail::IndexIterator;
+  index_type prev_;
+  index_type post_;
+};
+
+namespace detail {
+
+template <class T, class NodeTraits, class Index> class IndexIterator {
+public:
+  using size_type = ::estd::size_t;
+  using value_type = T;
+  using pointer = value_type *;
+  using reference = value_type &;
+
+  IndexIterator(pointer base, Index index) noexcept : base_{base}, index_{index} {}
+  IndexIterator &operator++() noexcept {
+    index_ = node(index_)->post_;
+    return *this;
+  }
+  IndexIterator operator++(int) noexcept {
+    IndexIterator const old = *this;
+    index_ = node(index_)->post_;
+    return old;
+  }
+  bool operator==(IndexIterator const &other) const noexcept { return index_ == other.index_; }
+  bool operator!=(IndexIterator const &other) const noexcept { return index_ != other.index_; }
+
+  reference operator*() const noexcept { return base_[index_]; }
+  pointer operator->() const noexcept { return &base_[index_]; }
+
+  /**
+   * @brief returns the index of element in storage
+   */
+  Index index() const noexcept { return index_; }
+
+private:
+  using node_type = typename ::estd::conditional<::estd::is_const<T>::value, IntrusiveIndexListNode<Index> const,
+                                                 IntrusiveIndexListNode<Index>>::type;
+  node_type *node(Index index) const noexcept { return static_cast<node_type *>(NodeTraits{}(&base_[index])); }
+
+  template <class, class, class> friend class ::estd::IntrusiveIndexList;
+  pointer base_;
+  Index index_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief intrusive doubly linked list whose elements live in one storage array and are linked by index.
+ * @tparam T element type
+ * @tparam NodeTraits stateless functor converting element pointer to pointer of embedded IntrusiveIndexListNode, e.g.
+ * IntrusiveListOffsetTraits
+ * @tparam Index unsigned integer type of links, storage must have less than max value of Index elements
+ */
+template <class T, class NodeTraits, class Index = unsigned short> class IntrusiveIndexList {
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using index_type = Index;
+  using node_type = IntrusiveIndexListNode<Index>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = ::estd::detail::IndexIterator<T, NodeTraits, Index>;
+  using const_iterator = ::estd::detail::IndexIterator<T const, NodeTraits, Index>;
+
+  static constexpr index_type npos = node_type::npos;
+
+  /**
+   * @brief creates list over storage, every element inserted must be in [base, base + capacity)
+   * @param  base: beginning of storage
+   * @param  capacity: number of elements in storage, must be less than npos
+   */
+  IntrusiveIndexList(pointer base, size_type capacity) noexcept
+      : base_{base}, head_{npos}, tail_{npos}, size_{0U} {
+    if (capacity >= static_cast<size_type>(npos)) {
+      ::estd::abort();
+    }
+  }
+  template <::estd::size_t N>
+  explicit IntrusiveIndexList(::estd::Array<T, N> &storage) noexcept : IntrusiveIndexList{storage.data(), N} {
+    static_assert(N < static_cast<size_type>(npos), "storage is too large for index type");
+  }
+  template <::estd::size_t N> explicit IntrusiveIndexList(T (&storage)[N]) noexcept : IntrusiveIndexList{storage, N} {
+    static_assert(N < static_cast<size_type>(npos), "storage is too large for index type");
+  }
+
+  /**
+   * @brief changes the storage address, e.g. after the storage and list have been copied together
+   * @param  base: new beginning of storage
+   */
+  void rebind(pointer base) noexcept { base_ = base; }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+
+  iterator begin() noexcept { return iterator{base_, head_}; }
+  iterator end() noexcept { return iterator{base_, npos}; }
+  const_iterator begin() const noexcept { return const_iterator{base_, head_}; }
+  const_iterator end() const noexcept { return const_iterator{base_, npos}; }
+
+  reference front() noexcept { return base_[head_]; }
+  const_reference front() const noexcept { return base_[head_]; }
+  reference back() noexcept { return base_[tail_]; }
+  const_reference back() const noexcept { return base_[tail_]; }
+
+  /**
+   * @brief returns the index of value in storage
+   */
+  index_type index_of(const_reference value) const noexcept { return static_cast<index_type>(&value - base_); }
+
+  /**
+   * @brief inserts value before pos.
+   * @param pos iterator before which the content will be inserted. pos may be the end() iterator
+   * @param value element value to insert
+   * @return iterator Iterator pointing to the inserted value.
+   */
+  iterator insert(iterator pos, reference value) noexcept {
+    index_type const index = index_of(value);
+    node_type *const n = node(index);
+    index_type const prev = pos.index_ == npos ? tail_ : node(pos.index_)->prev_;
+    n->prev_ = prev;
+    n->post_ = pos.index_;
+    if (prev == npos) {
+      head_ = index;
+    } else {
+      node(prev)->post_ = index;
+    }
+    if (pos.index_ == npos) {
+      tail_ = index;
+    } else {
+      node(pos.index_)->prev_ = index;
+    }
+    ++size_;
+    return iterator{base_, index};
+  }
+  /**
+   * @brief Removes the element at pos.
+   * @param pos iterator to the element to remove
+   * @return iterator Iterator following the last removed element.
+   * @pre The iterator pos must be valid and dereferenceable.
+   */
+  iterator erase(iterator pos) noexcept {
+    node_type *const n = node(pos.index_);
+    if (n->prev_ == npos) {
+      head_ = n->post_;
+    } else {
+      node(n->prev_)->post_ = n->post_;
+    }
+    if (n->post_ == npos) {
+      tail_ = n->prev_;
+    } else {
+      node(n->post_)->prev_ = n->prev_;
+    }
+    --size_;
+    return iterator{base_, n->post_};
+  }
+
+  /**
+   * @brief Appends the given element value to the end of the container.
+   * @param value the value of the element to append, must be in storage
+   */
+  void push_back(reference value) noexcept { insert(end(), value); }
+  /**
+   * @brief Prepends the given element value to the beginning of the container.
+   * @param value the value of the element to prepend, must be in storage
+   */
+  void push_front(reference value) noexcept { insert(begin(), value); }
+  /**
+   * @brief Removes the last element of the container. Calling pop_back on an empty container results in undefined
+   * behavior.
+   */
+  void pop_back() noexcept { erase(iterator{base_, tail_}); }
+  /**
+   * @brief Removes the first element of the container. Calling pop_front on an empty container results in undefined
+   * behavior.
+   */
+  void pop_front() noexcept { erase(begin()); }
+
+  size_type remove(const_reference value) noexcept {
+    return remove_if([&value](const_reference element) { return element == value; });
+  }
+
+  template <class UnaryPredicate> size_type remove_if(UnaryPredicate p) noexcept {
+    size_type old_size = size_;
+    iterator it = begin();
+    while (it != end()) {
+      if (p(*it)) {
+        it = erase(it);
+      } else {
+        ++it;
+      }
+    }
+    return old_size - size_;
+  }
+
+private:
+  node_type *node(index_type index) noexcept { return static_cast<node_type *>(NodeTraits{}(&base_[index])); }
+
+  pointer base_;
+  index_type head_;
+  index_type tail_;
+  size_type size_;
+};
+
+}; // namespace estd
+
+#endif
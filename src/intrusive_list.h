@@ -2,17 +2,26 @@
 #define __estd_intrusive_list__
 
 #include "abort.h"
+#include "intrusive_traits.h"
 #include "type.h"
 #include "type_traits.h"
 
 namespace estd {
 
 template <class Node> class IntrusiveList;
+template <class Node> class IntrusiveMpscQueue;
+template <class Node> class IntrusiveLockFreeStack;
 namespace {
 template <class Node> class BaseIterator;
 };
 
-template <class T, class GetNode, class GetElement> class IntrusiveListNode {
+/**
+ * @brief node of intrusive list, embedded in element.
+ * @tparam T element type
+ * @tparam GetNode stateless functor converting element pointer to node pointer
+ * @tparam GetElement stateless functor converting node pointer to element pointer
+ */
+template <class T, class GetNode, class GetElement = GetNode> class IntrusiveListNode {
 public:
   using value_type = T;
   using size_type = ::estd::size_t;
@@ -21,18 +30,11 @@ public:
   using pointer = value_type *;
   using const_pointer = const value_type *;
 
-  static IntrusiveListNode *get_node(T *const element) {
-    static GetNode get_node_instance{};
-    return get_node_instance(element);
-  }
-  static T *get_element(IntrusiveListNode *const node) {
-    static GetElement get_element_instance{};
-    return get_element_instance(node);
-  }
-  static T const *get_element(IntrusiveListNode const *const node) {
-    static GetElement get_element_instance{};
-    return get_element_instance(node);
+  static IntrusiveListNode *get_node(T *const element) noexcept {
+    return static_cast<IntrusiveListNode *>(GetNode{}(element));
   }
+  static T *get_element(IntrusiveListNode *const node) noexcept { return GetElement{}(node); }
+  static T const *get_element(IntrusiveListNode const *const node) noexcept { return GetElement{}(node); }
 
   IntrusiveListNode() noexcept : prev_{nullptr}, post_{nullptr} {}
 
@@ -111,6 +113,8 @@ public:
 
 protected:
   friend class IntrusiveList<IntrusiveListNode>;
+  friend class IntrusiveMpscQueue<IntrusiveListNode>;
+  friend class IntrusiveLockFreeStack<IntrusiveListNode>;
   friend class BaseIterator<IntrusiveListNode>;
   friend class BaseIterator<IntrusiveListNode const>;
   IntrusiveListNode *prev_;
@@ -175,6 +179,24 @@ public:
   const_iterator begin() const noexcept { return const_iterator{end_node_.post_}; }
   const_iterator end() const noexcept { return const_iterator{&end_node_}; }
 
+  /**
+   * @brief returns iterator pointing to value in O(1).
+   * @param value element in this list
+   * @return iterator Iterator pointing to value.
+   */
+  iterator iterator_to(reference value) noexcept { return iterator{Node::get_node(&value)}; }
+
+  /**
+   * @brief access the first element. If there are no elements in the container, the behavior is undefined.
+   */
+  reference front() noexcept { return *Node::get_element(end_node_.post_); }
+  const_reference front() const noexcept { return *Node::get_element(end_node_.post_); }
+  /**
+   * @brief access the last element. If there are no elements in the container, the behavior is undefined.
+   */
+  reference back() noexcept { return *Node::get_element(end_node_.prev_); }
+  const_reference back() const noexcept { return *Node::get_element(end_node_.prev_); }
+
   /**
    * @brief inserts value before pos.
    * @param pos iterator before which the content will be inserted. pos may be the end() iterator
@@ -252,7 +274,172 @@ public:
     return old_size - size_;
   }
 
+  /**
+   * @brief Transfers all elements from other before pos in O(1). other becomes empty.
+   * @param pos element before which the content will be inserted
+   * @param other another list to transfer the content from, must not be *this
+   */
+  void splice(iterator pos, IntrusiveList &other) noexcept {
+    if (other.empty()) {
+      return;
+    }
+    transfer(pos.node_p_, other.end_node_.post_, &other.end_node_);
+    size_ += other.size_;
+    other.size_ = 0U;
+  }
+  /**
+   * @brief Transfers the element pointed to by it from other before pos in O(1). Nothing happens when other is *this
+   * and pos is it or the element following it.
+   * @param pos element before which the content will be inserted
+   * @param other another list to transfer the content from, may be *this
+   * @param it the element to transfer from other
+   */
+  void splice(iterator pos, IntrusiveList &other, iterator it) noexcept {
+    transfer(pos.node_p_, it.node_p_, it.node_p_->post_);
+    --other.size_;
+    ++size_;
+  }
+  /**
+   * @brief Transfers the elements in the range [first, last) from other before pos. Pointer surgery is O(1), counting
+   * the range is linear in its length when other is not *this.
+   * @param pos element before which the content will be inserted
+   * @param other another list to transfer the content from, may be *this
+   * @param first begin of range of elements to transfer from other, pos must not be in the range
+   * @param last end of range of elements to transfer from other
+   */
+  void splice(iterator pos, IntrusiveList &other, iterator first, iterator last) noexcept {
+    size_type count = 0U;
+    if (&other != this) {
+      for (iterator it = first; it != last; ++it) {
+        ++count;
+      }
+    }
+    splice(pos, other, first, last, count);
+  }
+  /**
+   * @brief Transfers the count elements in the range [first, last) from other before pos in O(1).
+   * @param pos element before which the content will be inserted
+   * @param other another list to transfer the content from, may be *this
+   * @param first begin of range of elements to transfer from other, pos must not be in the range
+   * @param last end of range of elements to transfer from other
+   * @param count number of elements in [first, last)
+   */
+  void splice(iterator pos, IntrusiveList &other, iterator first, iterator last, size_type count) noexcept {
+    if (first == last) {
+      return;
+    }
+    transfer(pos.node_p_, first.node_p_, last.node_p_);
+    other.size_ -= count;
+    size_ += count;
+  }
+
+  /**
+   * @brief Merges two sorted lists into one by relinking nodes, other becomes empty. Equivalent elements of *this
+   * precede those of other.
+   * @param other another sorted list to merge, must not be *this
+   * @param comp comparison function object which returns true if the first argument is less than the second
+   */
+  template <class Compare> void merge(IntrusiveList &other, Compare comp) noexcept {
+    Node *current = end_node_.post_;
+    Node *other_current = other.end_node_.post_;
+    while (current != &end_node_ && other_current != &other.end_node_) {
+      if (comp(*Node::get_element(other_current), *Node::get_element(current))) {
+        Node *const other_next = other_current->post_;
+        transfer(current, other_current, other_next);
+        other_current = other_next;
+      } else {
+        current = current->post_;
+      }
+    }
+    if (other_current != &other.end_node_) {
+      transfer(&end_node_, other_current, &other.end_node_);
+    }
+    size_ += other.size_;
+    other.size_ = 0U;
+  }
+  void merge(IntrusiveList &other) noexcept {
+    merge(other, [](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+  }
+
+  /**
+   * @brief Sorts the elements by relinking nodes with stable bottom-up merge sort in O(n log n), no allocation.
+   * @param comp comparison function object which returns true if the first argument is less than the second
+   */
+  template <class Compare> void sort(Compare comp) noexcept {
+    if (size_ < 2U) {
+      return;
+    }
+    // bins[i] holds a sorted null-terminated chain of 2^i nodes, lower bins hold later elements
+    Node *bins[sizeof(size_type) * 8U] = {};
+    end_node_.prev_->post_ = nullptr;
+    Node *current = end_node_.post_;
+    while (current != nullptr) {
+      Node *const next = current->post_;
+      current->post_ = nullptr;
+      Node *run = current;
+      size_type i = 0U;
+      for (; bins[i] != nullptr; ++i) {
+        run = merge_chain(bins[i], run, comp);
+        bins[i] = nullptr;
+      }
+      bins[i] = run;
+      current = next;
+    }
+    Node *result = nullptr;
+    for (Node *const bin : bins) {
+      if (bin != nullptr) {
+        result = result == nullptr ? bin : merge_chain(bin, result, comp);
+      }
+    }
+    // restore prev_ links and circular structure
+    Node *prev = &end_node_;
+    for (current = result; current != nullptr; current = current->post_) {
+      prev->post_ = current;
+      current->prev_ = prev;
+      prev = current;
+    }
+    prev->post_ = &end_node_;
+    end_node_.prev_ = prev;
+  }
+  void sort() noexcept {
+    sort([](const_reference lhs, const_reference rhs) { return lhs < rhs; });
+  }
+
 private:
+  // move [first, last) before pos, nothing to do when pos is first or last
+  static void transfer(Node *const pos, Node *const first, Node *const last) noexcept {
+    if (pos == first || pos == last) {
+      return;
+    }
+    Node *const last_included = last->prev_;
+    first->prev_->post_ = last;
+    last->prev_ = first->prev_;
+    Node *const prev = pos->prev_;
+    prev->post_ = first;
+    first->prev_ = prev;
+    last_included->post_ = pos;
+    pos->prev_ = last_included;
+  }
+
+  // merge two sorted null-terminated chains linked by post_, nodes of first win ties
+  template <class Compare> static Node *merge_chain(Node *first, Node *second, Compare &comp) noexcept {
+    Node *head = nullptr;
+    Node **tail = &head;
+    while (first != nullptr && second != nullptr) {
+      if (comp(*Node::get_element(second), *Node::get_element(first))) {
+        *tail = second;
+        tail = &second->post_;
+        second = second->post_;
+      } else {
+        *tail = first;
+        tail = &first->post_;
+        first = first->post_;
+      }
+    }
+    *tail = first != nullptr ? first : second;
+    return head;
+  }
+
   Node end_node_{};
   size_type size_{};
 };
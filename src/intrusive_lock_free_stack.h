@@ -0,0 +1,139 @@
+/**
+ * @File Name: intrusive_lock_free_stack.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_lock_free_stack__
+#define __estd__intrusive_lock_free_stack__
+
+#include "atomic.h"
+#include "intrusive_list.h"
+#include "type.h"
+
+/**
+ * @brief number of significant bits of a pointer on 64 bits targets, the bits above hold the ABA tag of
+ * IntrusiveLockFreeStack. Override it when the target uses more address bits or tagged pointers.
+ */
+#ifndef ESTD_POINTER_ADDRESS_BITS
+#define ESTD_POINTER_ADDRESS_BITS 48
+#endif
+
+namespace estd {
+
+namespace detail {
+
+// pointer and ABA tag packed into one 64 bits word, so that it can be compared and swapped as a whole. Targets
+// without a lock-free 64 bits compare exchange, such as ARMv6-M, ARMv7-M and ARMv8-M baseline which have no
+// LDREXD/STREXD, are rejected at compile time instead of falling back to library calls
+template <class Node> class TaggedPointer {
+public:
+  using word_type = unsigned long long;
+  static_assert(sizeof(Node *) <= sizeof(word_type), "pointer must fit into 64 bits");
+  static_assert(__atomic_always_lock_free(sizeof(word_type), 0),
+                "IntrusiveLockFreeStack requires a lock-free 64 bits compare exchange on the target");
+
+  static constexpr unsigned kAddressBits = sizeof(Node *) == 4U ? 32U : ESTD_POINTER_ADDRESS_BITS;
+  static_assert(kAddressBits >= 32U && kAddressBits < 64U,
+                "ESTD_POINTER_ADDRESS_BITS must leave room for the tag and be less than 64");
+  static constexpr word_type kAddressMask = (word_type{1U} << kAddressBits) - 1U;
+
+  static word_type pack(Node *node, word_type tag) noexcept {
+    return static_cast<word_type>(reinterpret_cast<::estd::uintptr_t>(node)) | (tag << kAddressBits);
+  }
+  static Node *pointer(word_type word) noexcept {
+    return reinterpret_cast<Node *>(static_cast<::estd::uintptr_t>(word & kAddressMask));
+  }
+  static word_type tag(word_type word) noexcept { return word >> kAddressBits; }
+};
+
+}; // namespace detail
+
+/**
+ * @brief lock-free stack of elements which embed an IntrusiveListNode (Treiber stack). The next pointer of the node
+ * links the stack, so an element must not be in any IntrusiveList while it is pushed. Top is a pointer packed with a
+ * tag incremented by every change, which protects pop against ABA when an element is popped and pushed again between
+ * the load and the compare exchange of another thread. Elements must stay alive while other threads may pop, this is
+ * the usual case of elements owned by a pool.
+ * @tparam Node IntrusiveListNode type
+ */
+template <class Node> class IntrusiveLockFreeStack {
+public:
+  using value_type = typename Node::value_type;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using pointer = value_type *;
+
+  IntrusiveLockFreeStack() noexcept : top_{Tagged::pack(nullptr, 0U)} {}
+  IntrusiveLockFreeStack(IntrusiveLockFreeStack const &) = delete;
+  IntrusiveLockFreeStack &operator=(IntrusiveLockFreeStack const &) = delete;
+
+  /**
+   * @brief checks whether stack is empty, only a snapshot when called concurrently
+   */
+  bool empty() const noexcept { return Tagged::pointer(top_.load(::estd::memory_order_acquire)) == nullptr; }
+
+  /**
+   * @brief pushes value on top, safe to call from multiple threads
+   * @param  value: element to push, its node must not be linked
+   */
+  void push(reference value) noexcept {
+    Node *const node = Node::get_node(&value);
+    word_type top = top_.load(::estd::memory_order_relaxed);
+    do {
+      __atomic_store_n(&node->post_, Tagged::pointer(top), __ATOMIC_RELAXED);
+    } while (!top_.compare_exchange_weak(top, Tagged::pack(node, Tagged::tag(top) + 1U), ::estd::memory_order_release,
+                                         ::estd::memory_order_relaxed));
+  }
+  /**
+   * @brief removes the top element, safe to call from multiple threads
+   * @return pointer: removed element, nullptr if stack is empty
+   */
+  pointer pop() noexcept {
+    word_type top = top_.load(::estd::memory_order_acquire);
+    while (true) {
+      Node *const node = Tagged::pointer(top);
+      if (node == nullptr) {
+        return nullptr;
+      }
+      // node may be popped by another thread meanwhile, then the tag makes the compare exchange fail
+      Node *const next = __atomic_load_n(&node->post_, __ATOMIC_RELAXED);
+      if (top_.compare_exchange_weak(top, Tagged::pack(next, Tagged::tag(top) + 1U), ::estd::memory_order_acquire,
+                                     ::estd::memory_order_acquire)) {
+        return Node::get_element(node);
+      }
+    }
+  }
+  /**
+   * @brief takes all elements by one compare exchange, retried only under contention, and appends them to the back of
+   * list in the order they were pushed. Safe to call from multiple threads.
+   * @return size_type: number of moved elements
+   */
+  size_type drain_into(::estd::IntrusiveList<Node> &list) noexcept {
+    word_type top = top_.load(::estd::memory_order_acquire);
+    while (Tagged::pointer(top) != nullptr &&
+           !top_.compare_exchange_weak(top, Tagged::pack(nullptr, Tagged::tag(top) + 1U),
+                                       ::estd::memory_order_acquire, ::estd::memory_order_acquire)) {
+    }
+    // chain is from the newest to the oldest, each one is inserted in front of the previous one
+    size_type count = 0U;
+    typename ::estd::IntrusiveList<Node>::iterator position = list.end();
+    for (Node *node = Tagged::pointer(top); node != nullptr; ++count) {
+      Node *const next = node->post_;
+      position = list.insert(position, *Node::get_element(node));
+      node = next;
+    }
+    return count;
+  }
+
+private:
+  using Tagged = ::estd::detail::TaggedPointer<Node>;
+  using word_type = typename Tagged::word_type;
+
+  ::estd::Atomic<word_type> top_;
+};
+
+}; // namespace estd
+
+#endif
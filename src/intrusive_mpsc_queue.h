@@ -0,0 +1,114 @@
+/**
+ * @File Name: intrusive_mpsc_queue.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_mpsc_queue__
+#define __estd__intrusive_mpsc_queue__
+
+#include "atomic.h"
+#include "intrusive_list.h"
+#include "type.h"
+
+namespace estd {
+
+/**
+ * @brief unbounded lock-free multi producer single consumer queue of elements which embed an IntrusiveListNode
+ * (Dmitry Vyukov's intrusive queue with a stub node). The next pointer of the node links the queue, so an element
+ * must not be in any IntrusiveList while it is queued. Nothing is allocated, push is one atomic exchange and the
+ * consumer side only loads, except when it puts the stub back behind the last element.
+ * @tparam Node IntrusiveListNode type
+ */
+template <class Node> class IntrusiveMpscQueue {
+public:
+  using value_type = typename Node::value_type;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using pointer = value_type *;
+
+  IntrusiveMpscQueue() noexcept : head_{&stub_}, tail_{&stub_}, stub_{} { stub_.post_ = nullptr; }
+  IntrusiveMpscQueue(IntrusiveMpscQueue const &) = delete;
+  IntrusiveMpscQueue &operator=(IntrusiveMpscQueue const &) = delete;
+
+  /**
+   * @brief checks whether queue is empty, must only be called by the consumer. It reads the consumer side, so a call
+   * from a producer is a data race. Elements pushed concurrently may not be seen yet.
+   */
+  bool empty() const noexcept {
+    return tail_ == &stub_ && load_next(&stub_, ::estd::memory_order_acquire) == nullptr;
+  }
+
+  /**
+   * @brief appends value, safe to call from multiple producers and interrupts
+   * @param  value: element to append, its node must not be linked
+   */
+  void push(reference value) noexcept { push_node(Node::get_node(&value)); }
+
+  /**
+   * @brief removes the first element, must only be called by the consumer. It may return nullptr while a producer is
+   * between its exchange and its link, the element shows up in a later call.
+   * @return pointer: removed element, nullptr if queue is empty
+   */
+  pointer pop() noexcept {
+    Node *tail = tail_;
+    Node *next = load_next(tail, ::estd::memory_order_acquire);
+    if (tail == &stub_) {
+      if (next == nullptr) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = load_next(next, ::estd::memory_order_acquire);
+    }
+    if (next != nullptr) {
+      tail_ = next;
+      return Node::get_element(tail);
+    }
+    if (tail != head_.load(::estd::memory_order_acquire)) {
+      // producer has exchanged head but not linked it yet
+      return nullptr;
+    }
+    // tail is the last element, put stub behind it so that tail can be taken
+    push_node(&stub_);
+    next = load_next(tail, ::estd::memory_order_acquire);
+    if (next == nullptr) {
+      return nullptr;
+    }
+    tail_ = next;
+    return Node::get_element(tail);
+  }
+
+  /**
+   * @brief moves all linked elements to the back of list in FIFO order, must only be called by the consumer. Walking
+   * the chain only loads, so the whole batch costs one atomic exchange when the stub is put back behind the last one.
+   * @return size_type: number of moved elements
+   */
+  size_type drain_into(::estd::IntrusiveList<Node> &list) noexcept {
+    size_type count = 0U;
+    for (pointer element = pop(); element != nullptr; element = pop()) {
+      list.push_back(*element);
+      ++count;
+    }
+    return count;
+  }
+
+private:
+  static Node *load_next(Node const *node, ::estd::memory_order order) noexcept {
+    return __atomic_load_n(&node->post_, static_cast<int>(order));
+  }
+  void push_node(Node *node) noexcept {
+    __atomic_store_n(&node->post_, nullptr, __ATOMIC_RELAXED);
+    Node *const prev = head_.exchange(node, ::estd::memory_order_acq_rel);
+    __atomic_store_n(&prev->post_, node, __ATOMIC_RELEASE);
+  }
+
+  alignas(::estd::hardware_destructive_interference_size)::estd::Atomic<Node *> head_;
+  alignas(::estd::hardware_destructive_interference_size) Node *tail_;
+  Node stub_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,253 @@
+/**
+ * @File Name: intrusive_pairing_heap.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_pairing_heap__
+#define __estd__intrusive_pairing_heap__
+
+#include "algorithm.h"
+#include "intrusive_traits.h"
+#include "type.h"
+
+namespace estd {
+
+template <class Node, class Compare> class IntrusivePairingHeap;
+
+namespace detail {
+
+/**
+ * @brief links of pairing heap node. A tree is stored as first child and next sibling, prev is the parent for the
+ * first child and the previous sibling for others. prev of the root points to itself and prev of unlinked node is
+ * nullptr.
+ */
+class PairingHeapLinks {
+public:
+  PairingHeapLinks() noexcept : child_{nullptr}, sibling_{nullptr}, prev_{nullptr} {}
+  PairingHeapLinks(PairingHeapLinks const &) = delete;
+  PairingHeapLinks &operator=(PairingHeapLinks const &) = delete;
+
+  /**
+   * @brief checks whether node is in a heap
+   */
+  bool is_linked() const noexcept { return prev_ != nullptr; }
+
+private:
+  template <class, class> friend class ::estd::IntrusivePairingHeap;
+  PairingHeapLinks *child_;
+  PairingHeapLinks *sibling_;
+  PairingHeapLinks *prev_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief node of intrusive pairing heap, embedded in element.
+ * @tparam T element type
+ * @tparam GetNode stateless functor converting element pointer to node pointer
+ * @tparam GetElement stateless functor converting node pointer to element pointer
+ */
+template <class T, class GetNode, class GetElement = GetNode>
+class IntrusivePairingHeapNode : public ::estd::detail::PairingHeapLinks {
+public:
+  using value_type = T;
+  using reference = value_type &;
+
+  static IntrusivePairingHeapNode *get_node(T *const element) noexcept {
+    return static_cast<IntrusivePairingHeapNode *>(GetNode{}(element));
+  }
+  static T *get_element(IntrusivePairingHeapNode *const node) noexcept { return GetElement{}(node); }
+  static T const *get_element(IntrusivePairingHeapNode const *const node) noexcept { return GetElement{}(node); }
+
+  reference get_value() noexcept { return *get_element(this); }
+};
+
+/**
+ * @brief intrusive pairing heap, top is the element which no other element compares less than. push and
+ * decrease_key are O(1), pop and erase are amortized O(log n). Elements are unlinked when the heap is destroyed.
+ * @tparam Node IntrusivePairingHeapNode type
+ * @tparam Compare stateless comparison function object of elements
+ */
+template <class Node, class Compare = ::estd::less> class IntrusivePairingHeap {
+public:
+  using value_type = typename Node::value_type;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  IntrusivePairingHeap() noexcept : root_{nullptr}, size_{0U} {}
+  IntrusivePairingHeap(IntrusivePairingHeap const &) = delete;
+  IntrusivePairingHeap &operator=(IntrusivePairingHeap const &) = delete;
+  ~IntrusivePairingHeap() { clear(); }
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+
+  /**
+   * @brief access the top element. If there are no elements in the heap, the behavior is undefined.
+   */
+  reference top() noexcept { return *Node::get_element(static_cast<Node *>(root_)); }
+  const_reference top() const noexcept { return *Node::get_element(static_cast<Node const *>(root_)); }
+
+  /**
+   * @brief inserts value in O(1)
+   * @param value element to insert, its node must not be linked
+   */
+  void push(reference value) noexcept {
+    Links *const node = Node::get_node(&value);
+    node->child_ = nullptr;
+    set_root(root_ == nullptr ? node : meld(root_, node));
+    ++size_;
+  }
+  /**
+   * @brief removes the top element in amortized O(log n). If there are no elements in the heap, the behavior is
+   * undefined.
+   */
+  void pop() noexcept {
+    Links *const old_root = root_;
+    root_ = merge_pairs(old_root->child_);
+    if (root_ != nullptr) {
+      set_root(root_);
+    }
+    reset(old_root);
+    --size_;
+  }
+  /**
+   * @brief restores heap order after the key of value is changed toward the top in O(1), value must be in this heap
+   */
+  void decrease_key(reference value) noexcept {
+    Links *const node = Node::get_node(&value);
+    if (node != root_) {
+      cut(node);
+      set_root(meld(root_, node));
+    }
+  }
+  /**
+   * @brief removes value in amortized O(log n), value must be in this heap. Unlinking from its parent is O(1) and its
+   * children are merged by pairing.
+   */
+  void erase(reference value) noexcept {
+    Links *const node = Node::get_node(&value);
+    if (node == root_) {
+      pop();
+      return;
+    }
+    cut(node);
+    Links *const children = merge_pairs(node->child_);
+    if (children != nullptr) {
+      set_root(meld(root_, children));
+    }
+    reset(node);
+    --size_;
+  }
+  /**
+   * @brief Removes all elements in O(n)
+   */
+  void clear() noexcept {
+    // depth first walk, pending nodes are chained by sibling
+    Links *pending = root_;
+    if (pending != nullptr) {
+      pending->sibling_ = nullptr;
+    }
+    while (pending != nullptr) {
+      Links *const node = pending;
+      pending = node->sibling_;
+      Links *const child = node->child_;
+      if (child != nullptr) {
+        Links *last = child;
+        while (last->sibling_ != nullptr) {
+          last = last->sibling_;
+        }
+        last->sibling_ = pending;
+        pending = child;
+      }
+      reset(node);
+    }
+    root_ = nullptr;
+    size_ = 0U;
+  }
+
+private:
+  using Links = ::estd::detail::PairingHeapLinks;
+
+  static bool less(Links *lhs, Links *rhs) noexcept {
+    return Compare{}(*Node::get_element(static_cast<Node *>(lhs)), *Node::get_element(static_cast<Node *>(rhs)));
+  }
+  static void reset(Links *node) noexcept {
+    node->child_ = nullptr;
+    node->sibling_ = nullptr;
+    node->prev_ = nullptr;
+  }
+  void set_root(Links *node) noexcept {
+    node->sibling_ = nullptr;
+    node->prev_ = node;
+    root_ = node;
+  }
+
+  // links the larger root as first child of the other one, sibling of the result is not touched
+  static Links *meld(Links *lhs, Links *rhs) noexcept {
+    if (less(rhs, lhs)) {
+      Links *const tmp = lhs;
+      lhs = rhs;
+      rhs = tmp;
+    }
+    rhs->sibling_ = lhs->child_;
+    if (lhs->child_ != nullptr) {
+      lhs->child_->prev_ = rhs;
+    }
+    rhs->prev_ = lhs;
+    lhs->child_ = rhs;
+    return lhs;
+  }
+  // detaches the subtree of node from its parent
+  static void cut(Links *node) noexcept {
+    if (node->prev_->child_ == node) {
+      node->prev_->child_ = node->sibling_;
+    } else {
+      node->prev_->sibling_ = node->sibling_;
+    }
+    if (node->sibling_ != nullptr) {
+      node->sibling_->prev_ = node->prev_;
+    }
+    node->sibling_ = nullptr;
+  }
+  // two pass pairing of sibling list, returns the new root or nullptr
+  static Links *merge_pairs(Links *first) noexcept {
+    if (first == nullptr) {
+      return nullptr;
+    }
+    // left to right, melded pairs are pushed to a stack chained by sibling
+    Links *stack = nullptr;
+    while (first != nullptr) {
+      Links *const second = first->sibling_;
+      if (second == nullptr) {
+        first->sibling_ = stack;
+        stack = first;
+        break;
+      }
+      Links *const next = second->sibling_;
+      Links *const pair = meld(first, second);
+      pair->sibling_ = stack;
+      stack = pair;
+      first = next;
+    }
+    // right to left into one tree
+    Links *root = stack;
+    stack = stack->sibling_;
+    while (stack != nullptr) {
+      Links *const next = stack->sibling_;
+      root = meld(root, stack);
+      stack = next;
+    }
+    return root;
+  }
+
+  Links *root_;
+  size_type size_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,636 @@
+/**
+ * @File Name: intrusive_rb_tree.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_rb_tree__
+#define __estd__intrusive_rb_tree__
+
+#include "algorithm.h"
+#include "intrusive_traits.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+template <class Node, class Compare> class IntrusiveRbTree;
+
+namespace detail {
+
+struct RbTreeAlgorithms;
+template <class Node> class RbTreeIterator;
+
+/**
+ * @brief links of red black tree node. The tree header is also a RbTreeLinks whose parent is root and whose left and
+ * right are the minimum and maximum, root's parent is the header.
+ */
+class RbTreeLinks {
+public:
+  RbTreeLinks() noexcept : parent_{nullptr}, left_{nullptr}, right_{nullptr}, red_{false} {}
+  RbTreeLinks(RbTreeLinks const &) = delete;
+  RbTreeLinks &operator=(RbTreeLinks const &) = delete;
+
+  /**
+   * @brief checks whether node is in a tree
+   */
+  bool is_linked() const noexcept { return parent_ != nullptr; }
+
+private:
+  friend struct RbTreeAlgorithms;
+  template <class, class> friend class ::estd::IntrusiveRbTree;
+  template <class> friend class RbTreeIterator;
+  RbTreeLinks *parent_;
+  RbTreeLinks *left_;
+  RbTreeLinks *right_;
+  bool red_;
+};
+
+class RbTreeHeader : public RbTreeLinks {
+public:
+  RbTreeHeader() noexcept : RbTreeLinks{}, size_{0U} {}
+
+private:
+  friend struct RbTreeAlgorithms;
+  template <class, class> friend class ::estd::IntrusiveRbTree;
+  ::estd::size_t size_;
+};
+
+// node independent red black tree algorithms, ported from the classic header node design
+struct RbTreeAlgorithms {
+  using Links = RbTreeLinks;
+
+  static void init(RbTreeHeader &header) noexcept {
+    header.parent_ = nullptr;
+    header.left_ = &header;
+    header.right_ = &header;
+    header.red_ = true;
+    header.size_ = 0U;
+  }
+  static void reset(Links *node) noexcept {
+    node->parent_ = nullptr;
+    node->left_ = nullptr;
+    node->right_ = nullptr;
+    node->red_ = false;
+  }
+
+  static Links *minimum(Links *node) noexcept {
+    while (node->left_ != nullptr) {
+      node = node->left_;
+    }
+    return node;
+  }
+  static Links *maximum(Links *node) noexcept {
+    while (node->right_ != nullptr) {
+      node = node->right_;
+    }
+    return node;
+  }
+  static Links *increment(Links *node) noexcept {
+    if (node->right_ != nullptr) {
+      return minimum(node->right_);
+    }
+    Links *parent = node->parent_;
+    while (node == parent->right_) {
+      node = parent;
+      parent = parent->parent_;
+    }
+    // node is header when incrementing the maximum of single node tree
+    return node->right_ != parent ? parent : node;
+  }
+  static Links *decrement(Links *node) noexcept {
+    if (node->red_ && node->parent_->parent_ == node) {
+      // header, decrement of end is maximum
+      return node->right_;
+    }
+    if (node->left_ != nullptr) {
+      return maximum(node->left_);
+    }
+    Links *parent = node->parent_;
+    while (node == parent->left_) {
+      node = parent;
+      parent = parent->parent_;
+    }
+    return parent;
+  }
+
+  // finds header from any linked node in O(log n), root is the only node which is the grand parent of itself
+  static RbTreeHeader *header_of(Links *node) noexcept {
+    while (node->parent_->parent_ != node) {
+      node = node->parent_;
+    }
+    return static_cast<RbTreeHeader *>(node->parent_);
+  }
+
+  static void rotate_left(Links *node, Links *&root) noexcept {
+    Links *const pivot = node->right_;
+    node->right_ = pivot->left_;
+    if (pivot->left_ != nullptr) {
+      pivot->left_->parent_ = node;
+    }
+    pivot->parent_ = node->parent_;
+    if (node == root) {
+      root = pivot;
+    } else if (node == node->parent_->left_) {
+      node->parent_->left_ = pivot;
+    } else {
+      node->parent_->right_ = pivot;
+    }
+    pivot->left_ = node;
+    node->parent_ = pivot;
+  }
+  static void rotate_right(Links *node, Links *&root) noexcept {
+    Links *const pivot = node->left_;
+    node->left_ = pivot->right_;
+    if (pivot->right_ != nullptr) {
+      pivot->right_->parent_ = node;
+    }
+    pivot->parent_ = node->parent_;
+    if (node == root) {
+      root = pivot;
+    } else if (node == node->parent_->right_) {
+      node->parent_->right_ = pivot;
+    } else {
+      node->parent_->left_ = pivot;
+    }
+    pivot->right_ = node;
+    node->parent_ = pivot;
+  }
+
+  static bool is_red(Links const *node) noexcept { return node != nullptr && node->red_; }
+
+  // links node as left or right child of parent and restores red black properties
+  static void insert(bool insert_left, Links *node, Links *parent, RbTreeHeader &header) noexcept {
+    Links *&root = header.parent_;
+    node->parent_ = parent;
+    node->left_ = nullptr;
+    node->right_ = nullptr;
+    node->red_ = true;
+    if (insert_left) {
+      // when parent is header, left of header is the minimum
+      parent->left_ = node;
+      if (parent == &header) {
+        header.parent_ = node;
+        header.right_ = node;
+      } else if (parent == header.left_) {
+        header.left_ = node;
+      }
+    } else {
+      parent->right_ = node;
+      if (parent == header.right_) {
+        header.right_ = node;
+      }
+    }
+    ++header.size_;
+
+    while (node != root && node->parent_->red_) {
+      Links *const grand_parent = node->parent_->parent_;
+      if (node->parent_ == grand_parent->left_) {
+        Links *const uncle = grand_parent->right_;
+        if (is_red(uncle)) {
+          node->parent_->red_ = false;
+          uncle->red_ = false;
+          grand_parent->red_ = true;
+          node = grand_parent;
+        } else {
+          if (node == node->parent_->right_) {
+            node = node->parent_;
+            rotate_left(node, root);
+          }
+          node->parent_->red_ = false;
+          grand_parent->red_ = true;
+          rotate_right(grand_parent, root);
+        }
+      } else {
+        Links *const uncle = grand_parent->left_;
+        if (is_red(uncle)) {
+          node->parent_->red_ = false;
+          uncle->red_ = false;
+          grand_parent->red_ = true;
+          node = grand_parent;
+        } else {
+          if (node == node->parent_->left_) {
+            node = node->parent_;
+            rotate_right(node, root);
+          }
+          node->parent_->red_ = false;
+          grand_parent->red_ = true;
+          rotate_left(grand_parent, root);
+        }
+      }
+    }
+    root->red_ = false;
+  }
+
+  // unlinks target, restores red black properties and resets links of target
+  static void erase(Links *target, RbTreeHeader &header) noexcept {
+    Links *&root = header.parent_;
+    Links *&leftmost = header.left_;
+    Links *&rightmost = header.right_;
+    Links *removed = target;
+    Links *child = nullptr;
+    Links *child_parent = nullptr;
+
+    if (removed->left_ == nullptr) {
+      child = removed->right_;
+    } else if (removed->right_ == nullptr) {
+      child = removed->left_;
+    } else {
+      // two children, successor takes the place of target
+      removed = minimum(removed->right_);
+      child = removed->right_;
+    }
+    if (removed != target) {
+      target->left_->parent_ = removed;
+      removed->left_ = target->left_;
+      if (removed != target->right_) {
+        child_parent = removed->parent_;
+        if (child != nullptr) {
+          child->parent_ = removed->parent_;
+        }
+        removed->parent_->left_ = child;
+        removed->right_ = target->right_;
+        target->right_->parent_ = removed;
+      } else {
+        child_parent = removed;
+      }
+      if (root == target) {
+        root = removed;
+      } else if (target->parent_->left_ == target) {
+        target->parent_->left_ = removed;
+      } else {
+        target->parent_->right_ = removed;
+      }
+      removed->parent_ = target->parent_;
+      bool const red = removed->red_;
+      removed->red_ = target->red_;
+      target->red_ = red;
+      removed = target;
+    } else {
+      child_parent = removed->parent_;
+      if (child != nullptr) {
+        child->parent_ = removed->parent_;
+      }
+      if (root == target) {
+        root = child;
+      } else if (target->parent_->left_ == target) {
+        target->parent_->left_ = child;
+      } else {
+        target->parent_->right_ = child;
+      }
+      if (leftmost == target) {
+        leftmost = target->right_ == nullptr ? target->parent_ : minimum(child);
+      }
+      if (rightmost == target) {
+        rightmost = target->left_ == nullptr ? target->parent_ : maximum(child);
+      }
+    }
+
+    if (!removed->red_) {
+      while (child != root && !is_red(child)) {
+        if (child == child_parent->left_) {
+          Links *sibling = child_parent->right_;
+          if (sibling->red_) {
+            sibling->red_ = false;
+            child_parent->red_ = true;
+            rotate_left(child_parent, root);
+            sibling = child_parent->right_;
+          }
+          if (!is_red(sibling->left_) && !is_red(sibling->right_)) {
+            sibling->red_ = true;
+            child = child_parent;
+            child_parent = child_parent->parent_;
+          } else {
+            if (!is_red(sibling->right_)) {
+              sibling->left_->red_ = false;
+              sibling->red_ = true;
+              rotate_right(sibling, root);
+              sibling = child_parent->right_;
+            }
+            sibling->red_ = child_parent->red_;
+            child_parent->red_ = false;
+            if (sibling->right_ != nullptr) {
+              sibling->right_->red_ = false;
+            }
+            rotate_left(child_parent, root);
+            break;
+          }
+        } else {
+          Links *sibling = child_parent->left_;
+          if (sibling->red_) {
+            sibling->red_ = false;
+            child_parent->red_ = true;
+            rotate_right(child_parent, root);
+            sibling = child_parent->left_;
+          }
+          if (!is_red(sibling->right_) && !is_red(sibling->left_)) {
+            sibling->red_ = true;
+            child = child_parent;
+            child_parent = child_parent->parent_;
+          } else {
+            if (!is_red(sibling->left_)) {
+              sibling->right_->red_ = false;
+              sibling->red_ = true;
+              rotate_left(sibling, root);
+              sibling = child_parent->left_;
+            }
+            sibling->red_ = child_parent->red_;
+            child_parent->red_ = false;
+            if (sibling->left_ != nullptr) {
+              sibling->left_->red_ = false;
+            }
+            rotate_right(child_parent, root);
+            break;
+          }
+        }
+      }
+      if (child != nullptr) {
+        child->red_ = false;
+      }
+    }
+    --header.size_;
+    reset(target);
+  }
+
+  // resets links of all nodes in O(n) without recursion
+  static void clear(RbTreeHeader &header) noexcept {
+    Links *node = header.parent_;
+    while (node != nullptr) {
+      if (node->left_ != nullptr) {
+        node = node->left_;
+      } else if (node->right_ != nullptr) {
+        node = node->right_;
+      } else {
+        Links *const parent = node->parent_;
+        reset(node);
+        if (parent == &header) {
+          break;
+        }
+        if (parent->left_ == node) {
+          parent->left_ = nullptr;
+        } else {
+          parent->right_ = nullptr;
+        }
+        node = parent;
+      }
+    }
+    init(header);
+  }
+};
+
+template <class Node> class RbTreeIterator {
+public:
+  using size_type = ::estd::size_t;
+  using value_type = typename ::estd::conditional<::estd::is_const<Node>::value, const typename Node::value_type,
+                                                  typename Node::value_type>::type;
+  using pointer = value_type *;
+  using reference = value_type &;
+  using links_type =
+      typename ::estd::conditional<::estd::is_const<Node>::value, RbTreeLinks const, RbTreeLinks>::type;
+
+  explicit RbTreeIterator(links_type *links) noexcept : links_{links} {}
+  RbTreeIterator &operator++() noexcept {
+    links_ = RbTreeAlgorithms::increment(const_cast<RbTreeLinks *>(links_));
+    return *this;
+  }
+  RbTreeIterator operator++(int) noexcept {
+    RbTreeIterator const old = *this;
+    ++*this;
+    return old;
+  }
+  RbTreeIterator &operator--() noexcept {
+    links_ = RbTreeAlgorithms::decrement(const_cast<RbTreeLinks *>(links_));
+    return *this;
+  }
+  RbTreeIterator operator--(int) noexcept {
+    RbTreeIterator const old = *this;
+    --*this;
+    return old;
+  }
+  bool operator==(RbTreeIterator const &other) const noexcept { return links_ == other.links_; }
+  bool operator!=(RbTreeIterator const &other) const noexcept { return links_ != other.links_; }
+
+  reference operator*() const noexcept { return *Node::get_element(static_cast<Node *>(links_)); }
+  pointer operator->() const noexcept { return Node::get_element(static_cast<Node *>(links_)); }
+
+private:
+  template <class, class> friend class ::estd::IntrusiveRbTree;
+  links_type *links_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief node of intrusive red black tree, embedded in element.
+ * @tparam T element type
+ * @tparam GetNode stateless functor converting element pointer to node pointer
+ * @tparam GetElement stateless functor converting node pointer to element pointer
+ */
+template <class T, class GetNode, class GetElement = GetNode>
+class IntrusiveRbTreeNode : public ::estd::detail::RbTreeLinks {
+public:
+  using value_type = T;
+  using reference = value_type &;
+
+  static IntrusiveRbTreeNode *get_node(T *const element) noexcept {
+    return static_cast<IntrusiveRbTreeNode *>(GetNode{}(element));
+  }
+  static T *get_element(IntrusiveRbTreeNode *const node) noexcept { return GetElement{}(node); }
+  static T const *get_element(IntrusiveRbTreeNode const *const node) noexcept { return GetElement{}(node); }
+
+  /**
+   * @brief removes node from its tree in O(log n) without access to the tree, do nothing if node is not linked
+   */
+  void unlink() noexcept {
+    if (is_linked()) {
+      ::estd::detail::RbTreeAlgorithms::erase(this, *::estd::detail::RbTreeAlgorithms::header_of(this));
+    }
+  }
+  reference get_value() noexcept { return *get_element(this); }
+};
+
+/**
+ * @brief intrusive red black tree ordered by Compare. Insert, erase and lookup are O(log n), minimum and maximum are
+ * O(1). Equivalent elements are allowed and kept in insertion order. Elements are unlinked when the tree is destroyed.
+ * @tparam Node IntrusiveRbTreeNode type
+ * @tparam Compare stateless comparison function object of elements, lookup by key also calls it with key
+ */
+template <class Node, class Compare = ::estd::less> class IntrusiveRbTree {
+public:
+  using value_type = typename Node::value_type;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = ::estd::detail::RbTreeIterator<Node>;
+  using const_iterator = ::estd::detail::RbTreeIterator<Node const>;
+
+  IntrusiveRbTree() noexcept : header_{} { Algorithms::init(header_); }
+  IntrusiveRbTree(IntrusiveRbTree const &) = delete;
+  IntrusiveRbTree &operator=(IntrusiveRbTree const &) = delete;
+  ~IntrusiveRbTree() { clear(); }
+
+  bool empty() const noexcept { return header_.size_ == 0U; }
+  size_type size() const noexcept { return header_.size_; }
+
+  iterator begin() noexcept { return iterator{header_.left_}; }
+  iterator end() noexcept { return iterator{&header_}; }
+  const_iterator begin() const noexcept { return const_iterator{header_.left_}; }
+  const_iterator end() const noexcept { return const_iterator{&header_}; }
+
+  /**
+   * @brief access the smallest element in O(1)
+   */
+  reference front() noexcept { return *begin(); }
+  const_reference front() const noexcept { return *begin(); }
+  /**
+   * @brief access the largest element in O(1)
+   */
+  reference back() noexcept { return *iterator{header_.right_}; }
+  const_reference back() const noexcept { return *const_iterator{header_.right_}; }
+
+  /**
+   * @brief returns iterator pointing to value in O(1).
+   */
+  iterator iterator_to(reference value) noexcept { return iterator{Node::get_node(&value)}; }
+
+  /**
+   * @brief inserts value after the equivalent elements in O(log n)
+   * @param value element to insert, its node must not be linked
+   * @return iterator Iterator pointing to the inserted value.
+   */
+  iterator insert(reference value) noexcept {
+    Node *const node = Node::get_node(&value);
+    Links *parent = &header_;
+    Links *current = header_.parent_;
+    bool left = true;
+    while (current != nullptr) {
+      parent = current;
+      left = Compare{}(value, element(current));
+      current = left ? current->left_ : current->right_;
+    }
+    Algorithms::insert(left, node, parent, header_);
+    return iterator{node};
+  }
+  /**
+   * @brief inserts value if there is no equivalent element in O(log n)
+   * @param value element to insert, its node must not be linked
+   * @return bool: true if inserted
+   */
+  bool insert_unique(reference value) noexcept {
+    Links *parent = &header_;
+    Links *current = header_.parent_;
+    bool left = true;
+    while (current != nullptr) {
+      parent = current;
+      left = Compare{}(value, element(current));
+      current = left ? current->left_ : current->right_;
+    }
+    // the predecessor of insert position is the only candidate of equivalent element
+    iterator predecessor{parent};
+    if (left) {
+      if (predecessor == begin()) {
+        Algorithms::insert(true, Node::get_node(&value), parent, header_);
+        return true;
+      }
+      --predecessor;
+    }
+    if (!Compare{}(*predecessor, value)) {
+      return false;
+    }
+    Algorithms::insert(left, Node::get_node(&value), parent, header_);
+    return true;
+  }
+
+  /**
+   * @brief Removes the element at pos in O(log n).
+   * @return iterator Iterator following the removed element.
+   */
+  iterator erase(iterator pos) noexcept {
+    iterator next = pos;
+    ++next;
+    Algorithms::erase(pos.links_, header_);
+    return next;
+  }
+  /**
+   * @brief Removes value in O(log n), value must be in this tree.
+   */
+  void erase(reference value) noexcept { Algorithms::erase(Node::get_node(&value), header_); }
+  /**
+   * @brief Removes the smallest element. If there are no elements in the tree, the behavior is undefined.
+   */
+  void pop_front() noexcept { Algorithms::erase(header_.left_, header_); }
+  /**
+   * @brief Removes all elements in O(n)
+   */
+  void clear() noexcept { Algorithms::clear(header_); }
+
+  /**
+   * @brief returns the first element which is not less than key
+   */
+  template <class Key> iterator lower_bound(Key const &key) noexcept { return iterator{lower_bound_links(key)}; }
+  template <class Key> const_iterator lower_bound(Key const &key) const noexcept {
+    return const_iterator{lower_bound_links(key)};
+  }
+  /**
+   * @brief returns the first element which is greater than key
+   */
+  template <class Key> iterator upper_bound(Key const &key) noexcept { return iterator{upper_bound_links(key)}; }
+  template <class Key> const_iterator upper_bound(Key const &key) const noexcept {
+    return const_iterator{upper_bound_links(key)};
+  }
+  /**
+   * @brief returns the first element equivalent to key, end() if there is no such element
+   */
+  template <class Key> iterator find(Key const &key) noexcept { return iterator{find_links(key)}; }
+  template <class Key> const_iterator find(Key const &key) const noexcept { return const_iterator{find_links(key)}; }
+
+private:
+  using Algorithms = ::estd::detail::RbTreeAlgorithms;
+  using Links = ::estd::detail::RbTreeLinks;
+
+  static const_reference element(Links const *links) noexcept {
+    return *Node::get_element(static_cast<Node const *>(links));
+  }
+
+  template <class Key> Links *lower_bound_links(Key const &key) const noexcept {
+    Links *result = const_cast<Links *>(static_cast<Links const *>(&header_));
+    Links *current = header_.parent_;
+    while (current != nullptr) {
+      if (Compare{}(element(current), key)) {
+        current = current->right_;
+      } else {
+        result = current;
+        current = current->left_;
+      }
+    }
+    return result;
+  }
+  template <class Key> Links *upper_bound_links(Key const &key) const noexcept {
+    Links *result = const_cast<Links *>(static_cast<Links const *>(&header_));
+    Links *current = header_.parent_;
+    while (current != nullptr) {
+      if (Compare{}(key, element(current))) {
+        result = current;
+        current = current->left_;
+      } else {
+        current = current->right_;
+      }
+    }
+    return result;
+  }
+  template <class Key> Links *find_links(Key const &key) const noexcept {
+    Links *const result = lower_bound_links(key);
+    return result == &header_ || Compare{}(key, element(result))
+               ? const_cast<Links *>(static_cast<Links const *>(&header_))
+               : result;
+  }
+
+  ::estd::detail::RbTreeHeader header_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,44 @@
+/**
+ * @File Name: intrusive_traits.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__intrusive_traits__
+#define __estd__intrusive_traits__
+
+#include "type.h"
+
+namespace estd {
+
+/**
+ * @brief node traits which convert between element and embedded node by a compile time constant offset. It works for
+ * every intrusive node type (IntrusiveListNode, IntrusiveForwardListNode, ...).
+ * @tparam T element type
+ * @tparam Traits derived class which provides `static constexpr ::estd::size_t offset() noexcept`
+ * @code
+ * struct ST {
+ *   struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ST, NodeTraits> {
+ *     static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, node_); }
+ *   };
+ *   ::estd::IntrusiveListNode<ST, NodeTraits> node_;
+ * };
+ * @endcode
+ */
+template <class T, class Traits> struct IntrusiveListOffsetTraits {
+  void *operator()(T *const element) const noexcept { return reinterpret_cast<char *>(element) + Traits::offset(); }
+  void const *operator()(T const *const element) const noexcept {
+    return reinterpret_cast<char const *>(element) + Traits::offset();
+  }
+  template <class Node> T *operator()(Node *const node) const noexcept {
+    return reinterpret_cast<T *>(reinterpret_cast<char *>(node) - Traits::offset());
+  }
+  template <class Node> T const *operator()(Node const *const node) const noexcept {
+    return reinterpret_cast<T const *>(reinterpret_cast<char const *>(node) - Traits::offset());
+  }
+};
+
+}; // namespace estd
+
+#endif
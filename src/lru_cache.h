@@ -0,0 +1,231 @@
+/**
+ * @File Name: lru_cache.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__lru_cache__
+#define __estd__lru_cache__
+
+#include "algorithm.h"
+#include "array.h"
+#include "hash.h"
+#include "intrusive_hash_table.h"
+#include "intrusive_list.h"
+#include "type.h"
+
+namespace estd {
+
+namespace detail {
+
+template <bool Enable> class LruCacheStatistics {
+public:
+  using size_type = ::estd::size_t;
+
+  /**
+   * @brief returns the number of lookups which found the key
+   */
+  size_type hit_count() const noexcept { return hit_count_; }
+  /**
+   * @brief returns the number of lookups which did not find the key
+   */
+  size_type miss_count() const noexcept { return miss_count_; }
+  /**
+   * @brief returns the number of entries evicted to make room for new keys
+   */
+  size_type eviction_count() const noexcept { return eviction_count_; }
+  void reset_statistics() noexcept {
+    hit_count_ = 0U;
+    miss_count_ = 0U;
+    eviction_count_ = 0U;
+  }
+
+protected:
+  void on_hit() noexcept { ++hit_count_; }
+  void on_miss() noexcept { ++miss_count_; }
+  void on_eviction() noexcept { ++eviction_count_; }
+
+private:
+  size_type hit_count_{0U};
+  size_type miss_count_{0U};
+  size_type eviction_count_{0U};
+};
+
+template <> class LruCacheStatistics<false> {
+protected:
+  void on_hit() noexcept {}
+  void on_miss() noexcept {}
+  void on_eviction() noexcept {}
+};
+
+}; // namespace detail
+
+/**
+ * @brief fixed capacity least recently used cache. N entries live inline, each entry embeds two IntrusiveListNode:
+ * one links it into the recency list, most recent first, the other chains it into a bucket of an IntrusiveHashTable
+ * index. A hit relinks the entry to the front in O(1), inserting into a full cache reuses the least recent entry.
+ * @tparam K key type, must be default constructible
+ * @tparam V mapped type, must be default constructible
+ * @tparam N number of entries
+ * @tparam Hash hash function object, see estd::hash
+ * @tparam KeyEqual key equality function object
+ * @tparam EnableStatistics record hit, miss and eviction count
+ */
+template <class K, class V, ::estd::size_t N, class Hash = ::estd::hash<K>, class KeyEqual = ::estd::equal_to,
+          bool EnableStatistics = false>
+class LruCache : public ::estd::detail::LruCacheStatistics<EnableStatistics> {
+  static_assert(N != 0U, "capacity of LruCache must not be 0");
+  struct Entry;
+  struct GetRecencyNode;
+  struct GetIndexNode;
+  struct KeyOf;
+  using RecencyNode = ::estd::IntrusiveListNode<Entry, GetRecencyNode>;
+  using IndexNode = ::estd::IntrusiveListNode<Entry, GetIndexNode>;
+  using Index = ::estd::IntrusiveHashTable<IndexNode, KeyOf, Hash, KeyEqual>;
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = ::estd::size_t;
+
+  LruCache() noexcept : entries_{}, free_list_{}, recency_list_{}, buckets_{}, index_{buckets_} {
+    for (Entry &entry : entries_) {
+      free_list_.push_back(entry);
+    }
+  }
+  LruCache(LruCache const &) = delete;
+  LruCache &operator=(LruCache const &) = delete;
+
+  bool empty() const noexcept { return recency_list_.empty(); }
+  size_type size() const noexcept { return recency_list_.size(); }
+  static constexpr size_type capacity() noexcept { return N; }
+
+  /**
+   * @brief returns the value mapped to key and marks it most recently used, nullptr if key is not cached
+   */
+  V *find(K const &key) noexcept {
+    Entry *const entry = index_.find(key);
+    if (entry == nullptr) {
+      this->on_miss();
+      return nullptr;
+    }
+    this->on_hit();
+    touch(*entry);
+    return &entry->value_;
+  }
+  /**
+   * @brief returns the value mapped to key without changing recency or statistics, nullptr if key is not cached
+   */
+  V *peek(K const &key) noexcept {
+    Entry *const entry = index_.find(key);
+    return entry == nullptr ? nullptr : &entry->value_;
+  }
+  bool contains(K const &key) noexcept { return index_.find(key) != nullptr; }
+
+  /**
+   * @brief maps key to value and marks it most recently used. If key is not cached and the cache is full, the least
+   * recently used entry is evicted.
+   * @return V&: the cached value
+   */
+  V &put(K const &key, V const &value) noexcept {
+    Entry *const entry = index_.find(key);
+    if (entry != nullptr) {
+      entry->value_ = value;
+      touch(*entry);
+      return entry->value_;
+    }
+    Entry &fresh = acquire();
+    fresh.key_ = key;
+    fresh.value_ = value;
+    index_.insert(fresh);
+    recency_list_.push_front(fresh);
+    return fresh.value_;
+  }
+  /**
+   * @brief removes the entry with key
+   * @return bool: true if key was cached
+   */
+  bool erase(K const &key) noexcept {
+    Entry *const entry = index_.erase(key);
+    if (entry == nullptr) {
+      return false;
+    }
+    recency_list_.erase(recency_list_.iterator_to(*entry));
+    free_list_.push_front(*entry);
+    return true;
+  }
+  /**
+   * @brief removes all entries in O(size)
+   */
+  void clear() noexcept {
+    while (!recency_list_.empty()) {
+      Entry &entry = recency_list_.front();
+      index_.erase(entry);
+      recency_list_.pop_front();
+      free_list_.push_front(entry);
+    }
+  }
+
+  /**
+   * @brief calls fn(key, value) for every entry from the most to the least recently used
+   */
+  template <class Fn> void for_each(Fn &&fn) {
+    for (Entry &entry : recency_list_) {
+      fn(static_cast<K const &>(entry.key_), entry.value_);
+    }
+  }
+
+private:
+  static constexpr size_type kBucketCount = ::estd::detail::bit_ceil(N);
+
+  struct GetRecencyNode {
+    RecencyNode *operator()(Entry *const entry) const noexcept { return entry; }
+    RecencyNode const *operator()(Entry const *const entry) const noexcept { return entry; }
+    Entry *operator()(RecencyNode *const node) const noexcept { return static_cast<Entry *>(node); }
+    Entry const *operator()(RecencyNode const *const node) const noexcept { return static_cast<Entry const *>(node); }
+  };
+  struct GetIndexNode {
+    IndexNode *operator()(Entry *const entry) const noexcept { return entry; }
+    IndexNode const *operator()(Entry const *const entry) const noexcept { return entry; }
+    Entry *operator()(IndexNode *const node) const noexcept { return static_cast<Entry *>(node); }
+    Entry const *operator()(IndexNode const *const node) const noexcept { return static_cast<Entry const *>(node); }
+  };
+  struct KeyOf {
+    K const &operator()(Entry const &entry) const noexcept { return entry.key_; }
+  };
+  // free entries are linked by the recency node
+  struct Entry : RecencyNode, IndexNode {
+    Entry() noexcept : RecencyNode{}, IndexNode{}, key_{}, value_{} {}
+    K key_;
+    V value_;
+  };
+
+  void touch(Entry &entry) noexcept {
+    recency_list_.erase(recency_list_.iterator_to(entry));
+    recency_list_.push_front(entry);
+  }
+  // takes a free entry or evicts the least recently used one
+  Entry &acquire() noexcept {
+    if (!free_list_.empty()) {
+      Entry &entry = free_list_.front();
+      free_list_.pop_front();
+      return entry;
+    }
+    Entry &victim = recency_list_.back();
+    recency_list_.pop_back();
+    index_.erase(victim);
+    this->on_eviction();
+    return victim;
+  }
+
+  ::estd::Array<Entry, N> entries_;
+  ::estd::IntrusiveList<RecencyNode> free_list_;
+  ::estd::IntrusiveList<RecencyNode> recency_list_;
+  ::estd::Array<typename Index::Bucket, kBucketCount> buckets_;
+  Index index_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,63 @@
+/**
+ * @File Name: memory.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__memory__
+#define __estd__memory__
+
+#include "type.h"
+#include "utility.h"
+#include <new>
+
+namespace estd {
+
+/**
+ * @brief creates a T object initialized with arguments args... at given address p
+ * @param  p: pointer to the uninitialized storage
+ * @param  args: arguments used for initialization
+ * @return T*: pointer to the constructed object
+ */
+template <class T, class... Args> T *construct_at(T *p, Args &&...args) {
+  return ::new (static_cast<void *>(p)) T(::estd::forward<Args>(args)...);
+}
+
+/**
+ * @brief calls the destructor of the object pointed to by p
+ * @param  p: pointer to the object to be destroyed
+ */
+template <class T> void destroy_at(T *p) noexcept { p->~T(); }
+
+/**
+ * @brief copies count bytes from src to dest, the objects must not overlap
+ */
+inline void *memcpy(void *dest, void const *src, ::estd::size_t count) noexcept {
+  return __builtin_memcpy(dest, src, count);
+}
+
+/**
+ * @brief copies count bytes from src to dest, the objects may overlap
+ */
+inline void *memmove(void *dest, void const *src, ::estd::size_t count) noexcept {
+  return __builtin_memmove(dest, src, count);
+}
+
+/**
+ * @brief copies value into each of the first count bytes of dest
+ */
+inline void *memset(void *dest, int value, ::estd::size_t count) noexcept {
+  return __builtin_memset(dest, value, count);
+}
+
+/**
+ * @brief compares the first count bytes of lhs and rhs lexicographically as unsigned char
+ */
+inline int memcmp(void const *lhs, void const *rhs, ::estd::size_t count) noexcept {
+  return __builtin_memcmp(lhs, rhs, count);
+}
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,180 @@
+/**
+ * @File Name: monotonic_arena.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__monotonic_arena__
+#define __estd__monotonic_arena__
+
+#include "abort.h"
+#include "array.h"
+#include "memory.h"
+#include "type.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief bump allocator over a caller supplied buffer. Memory is released all at once by rewind or reset, the most
+ * recent allocation can also be released in stack order by deallocate. Destructors of created objects are never called.
+ */
+class MonotonicArena {
+public:
+  using size_type = ::estd::size_t;
+
+  /**
+   * @brief position of arena which can be rewound to
+   */
+  class Marker {
+  private:
+    friend class MonotonicArena;
+    explicit Marker(size_type offset) noexcept : offset_{offset} {}
+    size_type offset_;
+  };
+
+  /**
+   * @brief rewinds arena to the position of construction when leaving scope
+   */
+  class Scope {
+  public:
+    explicit Scope(MonotonicArena &arena) noexcept : arena_{arena}, marker_{arena.mark()} {}
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+    ~Scope() { arena_.rewind(marker_); }
+
+  private:
+    MonotonicArena &arena_;
+    Marker const marker_;
+  };
+
+  MonotonicArena(void *buffer, size_type size) noexcept
+      : buffer_{static_cast<unsigned char *>(buffer)}, capacity_{size}, offset_{0U} {}
+  template <::estd::size_t N>
+  explicit MonotonicArena(::estd::Array<unsigned char, N> &buffer) noexcept : MonotonicArena{buffer.data(), N} {}
+  MonotonicArena(MonotonicArena const &) = delete;
+  MonotonicArena &operator=(MonotonicArena const &) = delete;
+
+  /**
+   * @brief returns the size of buffer
+   */
+  size_type capacity() const noexcept { return capacity_; }
+  /**
+   * @brief returns the number of bytes used, including alignment padding
+   */
+  size_type used() const noexcept { return offset_; }
+  /**
+   * @brief returns the number of bytes not used
+   */
+  size_type remaining() const noexcept { return capacity_ - offset_; }
+
+  /**
+   * @brief allocates size bytes aligned to alignment
+   * @param  size: number of bytes to allocate
+   * @param  alignment: alignment of allocated memory, must be power of two
+   * @return void*: allocated memory, nullptr when buffer is exhausted
+   */
+  void *allocate(size_type size, size_type alignment = alignof(::estd::max_align_t)) noexcept {
+    ::estd::uintptr_t const address = reinterpret_cast<::estd::uintptr_t>(buffer_ + offset_);
+    size_type const padding = static_cast<size_type>((alignment - (address & (alignment - 1U))) & (alignment - 1U));
+    if (padding > remaining() || size > remaining() - padding) {
+      return nullptr;
+    }
+    unsigned char *const p = buffer_ + offset_ + padding;
+    offset_ += padding + size;
+    return p;
+  }
+  /**
+   * @brief releases p when it is the most recent allocation, otherwise memory is kept until rewind or reset
+   * @param  p: pointer returned by allocate
+   * @param  size: size passed to allocate
+   */
+  void deallocate(void *p, size_type size) noexcept {
+    if (static_cast<unsigned char *>(p) + size == buffer_ + offset_) {
+      offset_ = static_cast<size_type>(static_cast<unsigned char *>(p) - buffer_);
+    }
+  }
+
+  /**
+   * @brief allocates memory for T and constructs it in-place from args
+   * @param  args: arguments to forward to the constructor of the object
+   * @return T*: constructed object, nullptr when buffer is exhausted
+   */
+  template <class T, class... Args> T *create(Args &&...args) {
+    void *const p = allocate(sizeof(T), alignof(T));
+    if (p == nullptr) {
+      return nullptr;
+    }
+    return ::estd::construct_at(static_cast<T *>(p), ::estd::forward<Args>(args)...);
+  }
+
+  /**
+   * @brief returns the current position
+   */
+  Marker mark() const noexcept { return Marker{offset_}; }
+  /**
+   * @brief releases everything allocated after marker
+   * @param  marker: position returned by mark
+   */
+  void rewind(Marker marker) noexcept { offset_ = marker.offset_; }
+  /**
+   * @brief releases everything
+   */
+  void reset() noexcept { offset_ = 0U; }
+
+private:
+  unsigned char *const buffer_;
+  size_type const capacity_;
+  size_type offset_;
+};
+
+/**
+ * @brief allocator adapter of MonotonicArena which satisfies the requirements of Allocator. Abort when arena is
+ * exhausted.
+ * @tparam T value type
+ */
+template <class T> class ArenaAllocator {
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using difference_type = ::estd::ptrdiff_t;
+  using pointer = value_type *;
+
+  template <class U> struct rebind {
+    using other = ArenaAllocator<U>;
+  };
+
+  explicit ArenaAllocator(MonotonicArena &arena) noexcept : arena_{&arena} {}
+  template <class U> ArenaAllocator(ArenaAllocator<U> const &other) noexcept : arena_{other.arena_} {}
+
+  pointer allocate(size_type n) noexcept {
+    // n * sizeof(value_type) would wrap to a smaller block
+    if (n > static_cast<size_type>(-1) / sizeof(value_type)) {
+      ::estd::abort();
+    }
+    void *const p = arena_->allocate(n * sizeof(value_type), alignof(value_type));
+    if (p == nullptr) {
+      ::estd::abort();
+    }
+    return static_cast<pointer>(p);
+  }
+  void deallocate(pointer p, size_type n) noexcept { arena_->deallocate(p, n * sizeof(value_type)); }
+
+  MonotonicArena &arena() const noexcept { return *arena_; }
+
+private:
+  template <class U> friend class ArenaAllocator;
+  MonotonicArena *arena_;
+};
+
+template <class T, class U> bool operator==(ArenaAllocator<T> const &lhs, ArenaAllocator<U> const &rhs) noexcept {
+  return &lhs.arena() == &rhs.arena();
+}
+template <class T, class U> bool operator!=(ArenaAllocator<T> const &lhs, ArenaAllocator<U> const &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}; // namespace estd
+
+#endif
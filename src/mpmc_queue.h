@@ -0,0 +1,156 @@
+/**
+ * @File Name: mpmc_queue.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__mpmc_queue__
+#define __estd__mpmc_queue__
+
+#include "array.h"
+#include "atomic.h"
+#include "memory.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief bounded lock-free multi producer multi consumer queue. Every slot carries a sequence number which tells
+ * whether it is ready for the producer or the consumer of the current round (Dmitry Vyukov's bounded queue).
+ * @tparam T element type
+ * @tparam N capacity, must be power of two
+ */
+template <class T, ::estd::size_t N> class MpmcQueue {
+  static_assert(N >= 2U && (N & (N - 1U)) == 0U, "capacity of MpmcQueue must be power of two and at least 2");
+
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+
+  MpmcQueue() noexcept : enqueue_pos_{0U}, dequeue_pos_{0U}, cells_{} {
+    for (size_type i = 0U; i < N; ++i) {
+      cells_[i].sequence_.store(i, ::estd::memory_order_relaxed);
+    }
+  }
+  MpmcQueue(MpmcQueue const &) = delete;
+  MpmcQueue &operator=(MpmcQueue const &) = delete;
+  ~MpmcQueue() { clear(::estd::is_trivially_destructible<T>{}); }
+
+  /**
+   * @brief returns the maximum possible number of elements
+   * @return size_type: maximum possible number of elements
+   */
+  static constexpr size_type capacity() noexcept { return N; }
+  /**
+   * @brief returns the number of elements, only a snapshot when called concurrently
+   * @return size_type: number of elements
+   */
+  size_type size() const noexcept {
+    size_type const enqueue_pos = enqueue_pos_.load(::estd::memory_order_acquire);
+    size_type const dequeue_pos = dequeue_pos_.load(::estd::memory_order_acquire);
+    return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0U;
+  }
+  bool empty() const noexcept { return size() == 0U; }
+
+  /**
+   * @brief appends value, safe to call from multiple producers
+   * @param  value: element to append
+   * @return true: value is appended
+   * @return false: queue is full
+   */
+  bool push(const_reference value) { return emplace(value); }
+  bool push(value_type &&value) { return emplace(::estd::move(value)); }
+
+  /**
+   * @brief appends a new element constructed in-place from args, safe to call from multiple producers
+   * @param  args: arguments to forward to the constructor of the element
+   * @return true: element is appended
+   * @return false: queue is full
+   */
+  template <class... Args> bool emplace(Args &&...args) {
+    size_type pos = enqueue_pos_.load(::estd::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &cells_[pos & kMask];
+      size_type const sequence = cell->sequence_.load(::estd::memory_order_acquire);
+      ::estd::ptrdiff_t const diff = static_cast<::estd::ptrdiff_t>(sequence - pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1U, ::estd::memory_order_relaxed,
+                                               ::estd::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // slot still holds the element of previous round
+        return false;
+      } else {
+        pos = enqueue_pos_.load(::estd::memory_order_relaxed);
+      }
+    }
+    ::estd::construct_at(cell->element(), ::estd::forward<Args>(args)...);
+    cell->sequence_.store(pos + 1U, ::estd::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief removes the first element into value, safe to call from multiple consumers
+   * @param  value: destination of removed element
+   * @return true: value is removed
+   * @return false: queue is empty
+   */
+  bool pop(reference value) {
+    size_type pos = dequeue_pos_.load(::estd::memory_order_relaxed);
+    Cell *cell;
+    while (true) {
+      cell = &cells_[pos & kMask];
+      size_type const sequence = cell->sequence_.load(::estd::memory_order_acquire);
+      ::estd::ptrdiff_t const diff = static_cast<::estd::ptrdiff_t>(sequence - (pos + 1U));
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1U, ::estd::memory_order_relaxed,
+                                               ::estd::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // slot is not written in this round
+        return false;
+      } else {
+        pos = dequeue_pos_.load(::estd::memory_order_relaxed);
+      }
+    }
+    value_type *const element = cell->element();
+    value = ::estd::move(*element);
+    ::estd::destroy_at(element);
+    cell->sequence_.store(pos + kMask + 1U, ::estd::memory_order_release);
+    return true;
+  }
+
+private:
+  static constexpr size_type kMask = N - 1U;
+
+  struct Cell {
+    value_type *element() noexcept { return reinterpret_cast<value_type *>(&storage_[0]); }
+
+    ::estd::Atomic<size_type> sequence_;
+    alignas(value_type) unsigned char storage_[sizeof(value_type)];
+  };
+
+  void clear(::estd::true_type) noexcept {}
+  void clear(::estd::false_type) noexcept {
+    size_type const enqueue_pos = enqueue_pos_.load(::estd::memory_order_relaxed);
+    for (size_type pos = dequeue_pos_.load(::estd::memory_order_relaxed); pos != enqueue_pos; ++pos) {
+      ::estd::destroy_at(cells_[pos & kMask].element());
+    }
+  }
+
+  alignas(::estd::hardware_destructive_interference_size)::estd::Atomic<size_type> enqueue_pos_;
+  alignas(::estd::hardware_destructive_interference_size)::estd::Atomic<size_type> dequeue_pos_;
+  alignas(::estd::hardware_destructive_interference_size)::estd::Array<Cell, N> cells_;
+};
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,163 @@
+/**
+ * @File Name: object_pool.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__object_pool__
+#define __estd__object_pool__
+
+#include "abort.h"
+#include "intrusive_list.h"
+#include "memory.h"
+#include "type.h"
+#include "utility.h"
+
+namespace estd {
+
+namespace detail {
+
+template <bool Enable> class ObjectPoolStatistics {
+public:
+  using size_type = ::estd::size_t;
+
+  /**
+   * @brief returns the maximum number of objects in use at the same time
+   */
+  size_type high_water_mark() const noexcept { return high_water_mark_; }
+  /**
+   * @brief returns the number of allocations failed because pool is exhausted
+   */
+  size_type failure_count() const noexcept { return failure_count_; }
+
+protected:
+  void on_allocate(size_type in_use) noexcept {
+    high_water_mark_ = in_use > high_water_mark_ ? in_use : high_water_mark_;
+  }
+  void on_failure() noexcept { ++failure_count_; }
+
+private:
+  size_type high_water_mark_{0U};
+  size_type failure_count_{0U};
+};
+
+template <> class ObjectPoolStatistics<false> {
+protected:
+  void on_allocate(::estd::size_t) noexcept {}
+  void on_failure() noexcept {}
+};
+
+}; // namespace detail
+
+/**
+ * @brief fixed size object pool. N slots are preallocated in inline storage, free slots are linked into an
+ * IntrusiveList whose node lives in the storage of the free slot, so allocate and deallocate are O(1) without heap.
+ * @tparam T object type
+ * @tparam N number of slots
+ * @tparam EnableStatistics record high water mark and failure count
+ */
+template <class T, ::estd::size_t N, bool EnableStatistics = false>
+class ObjectPool : public ::estd::detail::ObjectPoolStatistics<EnableStatistics> {
+  struct Slot;
+
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using pointer = value_type *;
+
+  ObjectPool() noexcept : free_list_{} {
+    for (size_type i = 0U; i < N; ++i) {
+      free_list_.push_back(*::estd::construct_at(slots() + i));
+    }
+  }
+  ObjectPool(ObjectPool const &) = delete;
+  ObjectPool &operator=(ObjectPool const &) = delete;
+
+  /**
+   * @brief returns the number of slots
+   */
+  static constexpr size_type capacity() noexcept { return N; }
+  /**
+   * @brief returns the number of free slots
+   */
+  size_type available() const noexcept { return free_list_.size(); }
+  /**
+   * @brief returns the number of allocated slots
+   */
+  size_type in_use() const noexcept { return N - free_list_.size(); }
+  bool empty() const noexcept { return free_list_.empty(); }
+
+  /**
+   * @brief takes a free slot without constructing object
+   * @return pointer: uninitialized storage for one T, nullptr when pool is exhausted
+   */
+  pointer allocate() noexcept {
+    if (free_list_.empty()) {
+      this->on_failure();
+      return nullptr;
+    }
+    Slot *const slot = &*free_list_.begin();
+    free_list_.pop_front();
+    this->on_allocate(in_use());
+    return reinterpret_cast<pointer>(slot);
+  }
+  /**
+   * @brief gives back a slot returned by allocate, object must already be destroyed. Abort when p is not from this
+   * pool.
+   * @param  p: pointer returned by allocate
+   */
+  void deallocate(pointer p) noexcept {
+    Slot *const slot = reinterpret_cast<Slot *>(p);
+    if (slot < slots() || slot >= slots() + N) {
+      ::estd::abort();
+    }
+    free_list_.push_front(*::estd::construct_at(slot));
+  }
+
+  /**
+   * @brief allocates a slot and constructs object in-place from args
+   * @param  args: arguments to forward to the constructor of the object
+   * @return pointer: constructed object, nullptr when pool is exhausted
+   */
+  template <class... Args> pointer create(Args &&...args) {
+    pointer const p = allocate();
+    if (p != nullptr) {
+      ::estd::construct_at(p, ::estd::forward<Args>(args)...);
+    }
+    return p;
+  }
+  /**
+   * @brief destroys object and gives its slot back to pool
+   * @param  p: pointer returned by create
+   */
+  void destroy(pointer p) noexcept {
+    ::estd::destroy_at(p);
+    deallocate(p);
+  }
+
+private:
+  struct Slot {
+    // node is placed at the beginning of storage of a free slot
+    struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Slot, NodeTraits> {
+      static constexpr ::estd::size_t offset() noexcept { return 0U; }
+    };
+    using Node = ::estd::IntrusiveListNode<Slot, NodeTraits>;
+
+    Slot() noexcept : node_{} {}
+
+    union {
+      Node node_;
+      alignas(value_type) unsigned char storage_[sizeof(value_type)];
+    };
+  };
+
+  Slot *slots() noexcept { return reinterpret_cast<Slot *>(&storage_[0]); }
+
+  ::estd::IntrusiveList<typename Slot::Node> free_list_;
+  alignas(Slot) unsigned char storage_[sizeof(Slot) * N];
+};
+
+}; // namespace estd
+
+#endif
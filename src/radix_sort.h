@@ -0,0 +1,157 @@
+/**
+ * @File Name: radix_sort.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__radix_sort__
+#define __estd__radix_sort__
+
+#include "abort.h"
+#include "array.h"
+#include "memory.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+namespace detail {
+
+template <::estd::size_t Size> struct unsigned_of_size;
+template <> struct unsigned_of_size<1U> {
+  using type = unsigned char;
+};
+template <> struct unsigned_of_size<2U> {
+  using type = unsigned short;
+};
+template <> struct unsigned_of_size<4U> {
+  using type = unsigned int;
+};
+template <> struct unsigned_of_size<8U> {
+  using type = unsigned long long;
+};
+
+// maps key to unsigned integer with the same order
+template <class Key, bool IsFloat = ::estd::is_floating_point<Key>::value> struct RadixKey {
+  static_assert(::estd::is_integral<Key>::value && !::estd::is_same<Key, bool>::value,
+                "radix sort key must be integer or floating point");
+  using type = typename unsigned_of_size<sizeof(Key)>::type;
+  static constexpr type kSignBit = static_cast<type>(static_cast<type>(1U) << (sizeof(Key) * 8U - 1U));
+
+  static type encode(Key key) noexcept {
+    // flip sign bit so that negative integers are before positive ones
+    return static_cast<Key>(-1) < static_cast<Key>(0) ? static_cast<type>(static_cast<type>(key) ^ kSignBit)
+                                                      : static_cast<type>(key);
+  }
+};
+template <class Key> struct RadixKey<Key, true> {
+  using type = typename unsigned_of_size<sizeof(Key)>::type;
+  static constexpr type kSignBit = static_cast<type>(static_cast<type>(1U) << (sizeof(Key) * 8U - 1U));
+
+  static type encode(Key key) noexcept {
+    // negative floats have all bits flipped to reverse their order, positive floats only the sign bit
+    type bits;
+    ::estd::memcpy(&bits, &key, sizeof(Key));
+    return (bits & kSignBit) != 0U ? static_cast<type>(~bits) : static_cast<type>(bits | kSignBit);
+  }
+};
+
+struct IdentityKey {
+  template <class T> T const &operator()(T const &value) const noexcept { return value; }
+};
+
+}; // namespace detail
+
+/**
+ * @brief Sorts [first, last) in ascending order of key(element) by LSD radix sort, one pass per key byte. The sort is
+ * stable and does not allocate, histograms of all bytes are counted in one pass over the data and passes in which all
+ * keys share the same byte are skipped. Negative floating point keys are before positive ones, -0.0 is before 0.0 and
+ * NaN is ordered by its bit pattern. The histograms take 1 KiB of stack per key byte, 8 KiB for 64 bit keys.
+ * @param  first: beginning of range
+ * @param  last: end of range, at most 2^32 - 1 elements otherwise abort
+ * @param  scratch: buffer of at least last - first elements, its content is unspecified after sort
+ * @param  key: function returning integer or floating point key of element
+ */
+template <class T, class KeyFn> void radix_sort(T *first, T *last, T *scratch, KeyFn key) {
+  using Key = typename ::estd::remove_cvref<decltype(key(*first))>::type;
+  using Encoder = ::estd::detail::RadixKey<Key>;
+  using Unsigned = typename Encoder::type;
+  constexpr ::estd::size_t kPasses = sizeof(Unsigned);
+  constexpr ::estd::size_t kRadix = 256U;
+
+  ::estd::size_t const size = static_cast<::estd::size_t>(last - first);
+  if (size < 2U) {
+    return;
+  }
+  // 32 bit counters halve the stack used by the histograms on 64 bit targets
+  using Count = ::estd::uint32_t;
+  if (size > static_cast<Count>(-1)) {
+    ::estd::abort();
+  }
+  Count counts[kPasses][kRadix] = {};
+  for (::estd::size_t i = 0U; i < size; ++i) {
+    Unsigned const encoded = Encoder::encode(key(first[i]));
+    for (::estd::size_t pass = 0U; pass < kPasses; ++pass) {
+      ++counts[pass][(encoded >> (pass * 8U)) & 0xFFU];
+    }
+  }
+
+  T *source = first;
+  T *destination = scratch;
+  for (::estd::size_t pass = 0U; pass < kPasses; ++pass) {
+    Count *const count = counts[pass];
+    ::estd::size_t const shift = pass * 8U;
+    if (count[(Encoder::encode(key(source[0])) >> shift) & 0xFFU] == size) {
+      continue;
+    }
+    Count offset = 0U;
+    for (::estd::size_t digit = 0U; digit < kRadix; ++digit) {
+      Count const current = count[digit];
+      count[digit] = offset;
+      offset += current;
+    }
+    for (::estd::size_t i = 0U; i < size; ++i) {
+      ::estd::size_t const digit = (Encoder::encode(key(source[i])) >> shift) & 0xFFU;
+      destination[count[digit]++] = ::estd::move(source[i]);
+    }
+    T *const temp = source;
+    source = destination;
+    destination = temp;
+  }
+  if (source != first) {
+    for (::estd::size_t i = 0U; i < size; ++i) {
+      first[i] = ::estd::move(source[i]);
+    }
+  }
+}
+/**
+ * @brief Sorts [first, last) of integer or floating point in ascending order by LSD radix sort.
+ */
+template <class T> void radix_sort(T *first, T *last, T *scratch) {
+  ::estd::radix_sort(first, last, scratch, ::estd::detail::IdentityKey{});
+}
+
+/**
+ * @brief Sorts data in ascending order of key(element) by LSD radix sort.
+ * @param  data: array to sort
+ * @param  scratch: buffer of the same size, its content is unspecified after sort
+ * @param  key: function returning integer or floating point key of element
+ */
+template <class T, ::estd::size_t N, class KeyFn>
+void radix_sort(::estd::Array<T, N> &data, ::estd::Array<T, N> &scratch, KeyFn key) {
+  ::estd::radix_sort(data.begin(), data.end(), scratch.begin(), key);
+}
+/**
+ * @brief Sorts data of integer or floating point in ascending order by LSD radix sort.
+ * @param  data: array to sort
+ * @param  scratch: buffer of the same size, its content is unspecified after sort
+ */
+template <class T, ::estd::size_t N> void radix_sort(::estd::Array<T, N> &data, ::estd::Array<T, N> &scratch) {
+  ::estd::radix_sort(data.begin(), data.end(), scratch.begin(), ::estd::detail::IdentityKey{});
+}
+
+}; // namespace estd
+
+#endif
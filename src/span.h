@@ -0,0 +1,211 @@
+/**
+ * @File Name: span.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__span__
+#define __estd__span__
+
+#include "array.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief extent of Span whose size is only known at runtime
+ */
+constexpr ::estd::size_t dynamic_extent = static_cast<::estd::size_t>(-1);
+
+template <class T, ::estd::size_t Extent = ::estd::dynamic_extent> class Span;
+
+namespace detail {
+
+// static extent keeps only the pointer, the size is a compile time constant
+template <class T, ::estd::size_t Extent> class SpanStorage {
+protected:
+  constexpr SpanStorage(T *data, ::estd::size_t) noexcept : data_{data} {}
+  static constexpr ::estd::size_t get_size() noexcept { return Extent; }
+
+  T *data_;
+};
+template <class T> class SpanStorage<T, ::estd::dynamic_extent> {
+protected:
+  constexpr SpanStorage(T *data, ::estd::size_t size) noexcept : data_{data}, size_{size} {}
+  constexpr ::estd::size_t get_size() const noexcept { return size_; }
+
+  T *data_;
+  ::estd::size_t size_;
+};
+
+// element From can be viewed as element To, only adding const is allowed
+template <class From, class To>
+struct is_span_element_convertible
+    : ::estd::integral_constant<bool, ::estd::is_same<typename ::estd::remove_const<From>::type,
+                                                      typename ::estd::remove_const<To>::type>::value &&
+                                          (::estd::is_const<To>::value || !::estd::is_const<From>::value)> {};
+
+template <class T> struct is_span : ::estd::false_type {};
+template <class T, ::estd::size_t Extent> struct is_span<::estd::Span<T, Extent>> : ::estd::true_type {};
+
+template <class T> struct is_array_class : ::estd::false_type {};
+template <class T, ::estd::size_t N> struct is_array_class<::estd::Array<T, N>> : ::estd::true_type {};
+
+// contiguous container with data() and size() whose size is only known at runtime, such as StaticVector
+template <class Container, class T, class = void> struct is_span_compatible_container : ::estd::false_type {};
+template <class Container, class T>
+struct is_span_compatible_container<Container, T,
+                                    ::estd::void_t<decltype(::estd::declval<Container &>().data()),
+                                                   decltype(::estd::declval<Container &>().size())>>
+    : ::estd::integral_constant<
+          bool, !::estd::detail::is_span<typename ::estd::remove_cv<Container>::type>::value &&
+                    !::estd::detail::is_array_class<typename ::estd::remove_cv<Container>::type>::value &&
+                    ::estd::detail::is_span_element_convertible<
+                        typename ::estd::remove_reference<decltype(*::estd::declval<Container &>().data())>::type,
+                        T>::value> {};
+
+// extent of subspan<Offset, Count>
+template <::estd::size_t Extent, ::estd::size_t Offset, ::estd::size_t Count>
+struct subspan_extent
+    : ::estd::integral_constant<::estd::size_t, Count != ::estd::dynamic_extent ? Count
+                                                : Extent != ::estd::dynamic_extent ? Extent - Offset
+                                                                                   : ::estd::dynamic_extent> {};
+
+}; // namespace detail
+
+/**
+ * @brief non-owning view of a contiguous sequence of T. Functions taking Span instead of Array<T, N> are not
+ * templated on N. Slicing returns a new view without copying elements. With a static extent the size is a compile
+ * time constant and only the pointer is stored.
+ * @tparam T element type, const T for read only view
+ * @tparam Extent number of elements, or estd::dynamic_extent if the size is known at runtime
+ */
+template <class T, ::estd::size_t Extent> class Span : private ::estd::detail::SpanStorage<T, Extent> {
+  using Storage = ::estd::detail::SpanStorage<T, Extent>;
+
+public:
+  using element_type = T;
+  using value_type = typename ::estd::remove_cv<T>::type;
+  using size_type = ::estd::size_t;
+  using difference_type = ::estd::ptrdiff_t;
+  using pointer = T *;
+  using const_pointer = T const *;
+  using reference = T &;
+  using const_reference = T const &;
+  using iterator = pointer;
+
+  static constexpr size_type extent = Extent;
+
+  /**
+   * @brief empty view, only available for dynamic or zero extent
+   */
+  template <::estd::size_t E = Extent,
+            class = typename ::estd::enable_if<E == 0U || E == ::estd::dynamic_extent>::type>
+  constexpr Span() noexcept : Storage{nullptr, 0U} {}
+  /**
+   * @brief views [first, first + count), count must be Extent for static extent
+   */
+  constexpr Span(pointer first, size_type count) noexcept : Storage{first, count} {}
+  /**
+   * @brief views [first, last), last - first must be Extent for static extent. last is a template parameter so that a
+   * literal 0 count is not ambiguous
+   */
+  template <class P, class = typename ::estd::enable_if<::estd::is_same<P, pointer>::value>::type>
+  constexpr Span(pointer first, P last) noexcept : Storage{first, static_cast<size_type>(last - first)} {}
+  template <class U, ::estd::size_t N,
+            class = typename ::estd::enable_if<(Extent == ::estd::dynamic_extent || Extent == N) &&
+                                               ::estd::detail::is_span_element_convertible<U, T>::value>::type>
+  constexpr Span(U (&array)[N]) noexcept : Storage{array, N} {}
+  template <class U, ::estd::size_t N,
+            class = typename ::estd::enable_if<(Extent == ::estd::dynamic_extent || Extent == N) &&
+                                               ::estd::detail::is_span_element_convertible<U, T>::value>::type>
+  constexpr Span(::estd::Array<U, N> &array) noexcept : Storage{array.data(), N} {}
+  template <class U, ::estd::size_t N,
+            class = typename ::estd::enable_if<(Extent == ::estd::dynamic_extent || Extent == N) &&
+                                               ::estd::detail::is_span_element_convertible<U const, T>::value>::type>
+  constexpr Span(::estd::Array<U, N> const &array) noexcept : Storage{array.data(), N} {}
+  /**
+   * @brief views the elements of a container with data() and size(), only available for dynamic extent
+   */
+  template <class Container,
+            class = typename ::estd::enable_if<
+                Extent == ::estd::dynamic_extent &&
+                ::estd::detail::is_span_compatible_container<Container, T>::value>::type>
+  constexpr Span(Container &container) noexcept : Storage{container.data(), container.size()} {}
+  /**
+   * @brief converts from a view of compatible elements, a static extent must match
+   */
+  template <class U, ::estd::size_t N,
+            class = typename ::estd::enable_if<(Extent == ::estd::dynamic_extent || Extent == N) &&
+                                               ::estd::detail::is_span_element_convertible<U, T>::value>::type>
+  constexpr Span(Span<U, N> const &other) noexcept : Storage{other.data(), other.size()} {}
+
+  constexpr size_type size() const noexcept { return this->get_size(); }
+  constexpr size_type size_bytes() const noexcept { return this->get_size() * sizeof(T); }
+  constexpr bool empty() const noexcept { return this->get_size() == 0U; }
+  constexpr pointer data() const noexcept { return this->data_; }
+
+  constexpr reference operator[](size_type pos) const noexcept { return this->data_[pos]; }
+  constexpr reference front() const noexcept { return this->data_[0]; }
+  constexpr reference back() const noexcept { return this->data_[size() - 1U]; }
+
+  constexpr iterator begin() const noexcept { return this->data_; }
+  constexpr iterator end() const noexcept { return this->data_ + size(); }
+
+  /**
+   * @brief views the first Count elements
+   */
+  template <::estd::size_t Count> constexpr Span<T, Count> first() const noexcept {
+    static_assert(Extent == ::estd::dynamic_extent || Count <= Extent, "Count is out of range");
+    return Span<T, Count>{this->data_, Count};
+  }
+  constexpr Span<T> first(size_type count) const noexcept { return Span<T>{this->data_, count}; }
+  /**
+   * @brief views the last Count elements
+   */
+  template <::estd::size_t Count> constexpr Span<T, Count> last() const noexcept {
+    static_assert(Extent == ::estd::dynamic_extent || Count <= Extent, "Count is out of range");
+    return Span<T, Count>{this->data_ + (size() - Count), Count};
+  }
+  constexpr Span<T> last(size_type count) const noexcept { return Span<T>{this->data_ + (size() - count), count}; }
+  /**
+   * @brief views Count elements from Offset, or the rest if Count is dynamic_extent. The result has a static extent
+   * when Count is given or this has a static extent.
+   */
+  template <::estd::size_t Offset, ::estd::size_t Count = ::estd::dynamic_extent>
+  constexpr Span<T, ::estd::detail::subspan_extent<Extent, Offset, Count>::value> subspan() const noexcept {
+    static_assert(Extent == ::estd::dynamic_extent || Offset <= Extent, "Offset is out of range");
+    static_assert(Extent == ::estd::dynamic_extent || Count == ::estd::dynamic_extent || Count <= Extent - Offset,
+                  "Count is out of range");
+    return Span<T, ::estd::detail::subspan_extent<Extent, Offset, Count>::value>{
+        this->data_ + Offset, Count == ::estd::dynamic_extent ? size() - Offset : Count};
+  }
+  constexpr Span<T> subspan(size_type offset, size_type count = ::estd::dynamic_extent) const noexcept {
+    return Span<T>{this->data_ + offset, count == ::estd::dynamic_extent ? size() - offset : count};
+  }
+};
+
+template <class T, ::estd::size_t Extent> constexpr ::estd::size_t Span<T, Extent>::extent;
+
+/**
+ * @brief creates Span with the extent deduced from the argument, C++14 has no class template argument deduction
+ */
+template <class T, ::estd::size_t N> constexpr Span<T, N> make_span(T (&array)[N]) noexcept {
+  return Span<T, N>{array};
+}
+template <class T, ::estd::size_t N> constexpr Span<T, N> make_span(::estd::Array<T, N> &array) noexcept {
+  return Span<T, N>{array};
+}
+template <class T, ::estd::size_t N> constexpr Span<T const, N> make_span(::estd::Array<T, N> const &array) noexcept {
+  return Span<T const, N>{array};
+}
+template <class T> constexpr Span<T> make_span(T *first, ::estd::size_t count) noexcept {
+  return Span<T>{first, count};
+}
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,202 @@
+/**
+ * @File Name: spsc_ring.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__spsc_ring__
+#define __estd__spsc_ring__
+
+#include "array.h"
+#include "atomic.h"
+#include "memory.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+/**
+ * @brief lock-free single producer single consumer ring buffer. Producer and consumer may run in different threads or
+ * in interrupt and main loop.
+ * @tparam T element type, must be trivially copyable
+ * @tparam N capacity, must be power of two
+ */
+template <class T, ::estd::size_t N> class SpscRing {
+  static_assert(N != 0U && (N & (N - 1U)) == 0U, "capacity of SpscRing must be power of two");
+  static_assert(::estd::is_trivially_copyable<T>::value, "element of SpscRing must be trivially copyable");
+
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+
+  SpscRing() noexcept : head_{0U}, tail_cache_{0U}, tail_{0U}, head_cache_{0U}, buffer_{} {}
+  SpscRing(SpscRing const &) = delete;
+  SpscRing &operator=(SpscRing const &) = delete;
+
+  /**
+   * @brief returns the maximum possible number of elements
+   * @return size_type: maximum possible number of elements
+   */
+  static constexpr size_type capacity() noexcept { return N; }
+  /**
+   * @brief returns the number of elements. Called from a thread other than the producer and consumer, such as a
+   * monitor, the result is only a snapshot which may already be outdated, but it is never greater than N.
+   * @return size_type: number of elements
+   */
+  size_type size() const noexcept {
+    // tail is loaded first, head can only have moved further since, so head - tail does not wrap
+    size_type const tail = tail_.load(::estd::memory_order_acquire);
+    size_type const head = head_.load(::estd::memory_order_acquire);
+    size_type const size = head - tail;
+    return size < N ? size : N;
+  }
+  bool empty() const noexcept { return size() == 0U; }
+  bool full() const noexcept { return size() == N; }
+
+  // producer
+
+  /**
+   * @brief appends value, producer only
+   * @param  value: element to append
+   * @return true: value is appended
+   * @return false: ring is full
+   */
+  bool push(const_reference value) noexcept {
+    size_type const head = head_.load(::estd::memory_order_relaxed);
+    if (writable(head, 1U) == 0U) {
+      return false;
+    }
+    buffer_[head & kMask] = value;
+    head_.store(head + 1U, ::estd::memory_order_release);
+    return true;
+  }
+  /**
+   * @brief appends up to count elements from values, producer only. Copies at most two contiguous segments.
+   * @param  values: elements to append
+   * @param  count: number of elements in values
+   * @return size_type: number of appended elements
+   */
+  size_type push_n(const_pointer values, size_type count) noexcept {
+    size_type const head = head_.load(::estd::memory_order_relaxed);
+    size_type const writable_count = writable(head, count);
+    count = count < writable_count ? count : writable_count;
+    size_type const offset = head & kMask;
+    size_type const first = (N - offset) < count ? (N - offset) : count;
+    ::estd::memcpy(&buffer_[offset], values, first * sizeof(value_type));
+    ::estd::memcpy(&buffer_[0], values + first, (count - first) * sizeof(value_type));
+    head_.store(head + count, ::estd::memory_order_release);
+    return count;
+  }
+  /**
+   * @brief gets the contiguous writable region for in place writing, producer only. Data is published by commit_write.
+   * @param  count: number of writable elements in returned region
+   * @return pointer: beginning of writable region
+   */
+  pointer peek_write(size_type &count) noexcept {
+    size_type const head = head_.load(::estd::memory_order_relaxed);
+    size_type const writable_count = writable(head, N);
+    size_type const offset = head & kMask;
+    count = (N - offset) < writable_count ? (N - offset) : writable_count;
+    return &buffer_[offset];
+  }
+  /**
+   * @brief publishes count elements written into region returned by peek_write, producer only
+   * @param  count: number of written elements, not more than the count returned by peek_write
+   */
+  void commit_write(size_type count) noexcept {
+    head_.store(head_.load(::estd::memory_order_relaxed) + count, ::estd::memory_order_release);
+  }
+
+  // consumer
+
+  /**
+   * @brief removes the first element into value, consumer only
+   * @param  value: destination of removed element
+   * @return true: value is removed
+   * @return false: ring is empty
+   */
+  bool pop(reference value) noexcept {
+    size_type const tail = tail_.load(::estd::memory_order_relaxed);
+    if (readable(tail, 1U) == 0U) {
+      return false;
+    }
+    value = buffer_[tail & kMask];
+    tail_.store(tail + 1U, ::estd::memory_order_release);
+    return true;
+  }
+  /**
+   * @brief removes up to count elements into values, consumer only. Copies at most two contiguous segments.
+   * @param  values: destination of removed elements
+   * @param  count: capacity of values
+   * @return size_type: number of removed elements
+   */
+  size_type pop_n(pointer values, size_type count) noexcept {
+    size_type const tail = tail_.load(::estd::memory_order_relaxed);
+    size_type const readable_count = readable(tail, count);
+    count = count < readable_count ? count : readable_count;
+    size_type const offset = tail & kMask;
+    size_type const first = (N - offset) < count ? (N - offset) : count;
+    ::estd::memcpy(values, &buffer_[offset], first * sizeof(value_type));
+    ::estd::memcpy(values + first, &buffer_[0], (count - first) * sizeof(value_type));
+    tail_.store(tail + count, ::estd::memory_order_release);
+    return count;
+  }
+  /**
+   * @brief gets the contiguous readable region for in place reading, consumer only. Region is released by commit_read.
+   * @param  count: number of readable elements in returned region
+   * @return const_pointer: beginning of readable region
+   */
+  const_pointer peek_read(size_type &count) noexcept {
+    size_type const tail = tail_.load(::estd::memory_order_relaxed);
+    size_type const readable_count = readable(tail, N);
+    size_type const offset = tail & kMask;
+    count = (N - offset) < readable_count ? (N - offset) : readable_count;
+    return &buffer_[offset];
+  }
+  /**
+   * @brief releases count elements read from region returned by peek_read, consumer only
+   * @param  count: number of consumed elements, not more than the count returned by peek_read
+   */
+  void commit_read(size_type count) noexcept {
+    tail_.store(tail_.load(::estd::memory_order_relaxed) + count, ::estd::memory_order_release);
+  }
+
+private:
+  static constexpr size_type kMask = N - 1U;
+
+  // producer side, reload tail only when cached value can not satisfy needed
+  size_type writable(size_type head, size_type needed) noexcept {
+    size_type count = N - (head - tail_cache_);
+    if (count < needed) {
+      tail_cache_ = tail_.load(::estd::memory_order_acquire);
+      count = N - (head - tail_cache_);
+    }
+    return count;
+  }
+  // consumer side, reload head only when cached value can not satisfy needed
+  size_type readable(size_type tail, size_type needed) noexcept {
+    size_type count = head_cache_ - tail;
+    if (count < needed) {
+      head_cache_ = head_.load(::estd::memory_order_acquire);
+      count = head_cache_ - tail;
+    }
+    return count;
+  }
+
+  // written by producer
+  alignas(::estd::hardware_destructive_interference_size)::estd::Atomic<size_type> head_;
+  size_type tail_cache_;
+  // written by consumer
+  alignas(::estd::hardware_destructive_interference_size)::estd::Atomic<size_type> tail_;
+  size_type head_cache_;
+  alignas(::estd::hardware_destructive_interference_size)::estd::Array<value_type, N> buffer_;
+};
+
+}; // namespace estd
+
+#endif
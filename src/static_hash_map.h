@@ -0,0 +1,257 @@
+/**
+ * @File Name: static_hash_map.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__static_hash_map__
+#define __estd__static_hash_map__
+
+#include "abort.h"
+#include "algorithm.h"
+#include "array.h"
+#include "hash.h"
+#include "type.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief fixed capacity hash map by Robin Hood linear probing with backward shift deletion. Metadata, keys and values
+ * are kept in separate arrays. The 16 bits metadata of a slot holds the probe distance and 8 bits of the hash, so a
+ * probe sequence scans the dense metadata array and reads a key only when its hash bits match.
+ * @tparam K key type
+ * @tparam V mapped type
+ * @tparam N number of slots, must be power of two. All slots can be used but probes get longer above 0.9 load factor
+ * @tparam Hash hash function object, see estd::hash
+ * @tparam KeyEqual key equality function object
+ */
+template <class K, class V, ::estd::size_t N, class Hash = ::estd::hash<K>, class KeyEqual = ::estd::equal_to>
+class StaticHashMap {
+  static_assert(N >= 2U && (N & (N - 1U)) == 0U, "slots of StaticHashMap must be power of two");
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = ::estd::size_t;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  StaticHashMap() noexcept : metadata_{}, keys_{}, values_{}, size_{0U} {}
+
+  bool empty() const noexcept { return size_ == 0U; }
+  size_type size() const noexcept { return size_; }
+  static constexpr size_type capacity() noexcept { return N; }
+  /**
+   * @brief removes all elements in O(N)
+   */
+  void clear() noexcept {
+    metadata_.fill(metadata_type{kEmpty});
+    size_ = 0U;
+  }
+
+  /**
+   * @brief returns the ratio of used slots
+   */
+  float load_factor() const noexcept { return static_cast<float>(size_) / static_cast<float>(N); }
+  /**
+   * @brief returns the longest probe distance of all elements in O(N), 0 means every element is in its home slot
+   */
+  size_type max_probe_length() const noexcept {
+    size_type longest = 0U;
+    for (size_type i = 0U; i < N; ++i) {
+      if (metadata_[i] != kEmpty && distance(metadata_[i]) > longest) {
+        longest = distance(metadata_[i]);
+      }
+    }
+    return longest;
+  }
+  /**
+   * @brief returns the average probe distance of all elements in O(N)
+   */
+  float average_probe_length() const noexcept {
+    size_type total = 0U;
+    for (size_type i = 0U; i < N; ++i) {
+      if (metadata_[i] != kEmpty) {
+        total += distance(metadata_[i]);
+      }
+    }
+    return size_ == 0U ? 0.0F : static_cast<float>(total) / static_cast<float>(size_);
+  }
+
+  /**
+   * @brief returns the value mapped to key, nullptr if key is not found
+   */
+  V *find(K const &key) noexcept {
+    size_type const slot = search(key);
+    return slot == kNotFound ? nullptr : &values_[slot];
+  }
+  V const *find(K const &key) const noexcept {
+    size_type const slot = search(key);
+    return slot == kNotFound ? nullptr : &values_[slot];
+  }
+  bool contains(K const &key) const noexcept { return search(key) != kNotFound; }
+  /**
+   * @brief returns the value mapped to key, abort if key is not found
+   */
+  V &at(K const &key) noexcept {
+    V *const value = find(key);
+    if (value == nullptr) {
+      ::estd::abort();
+    }
+    return *value;
+  }
+  V const &at(K const &key) const noexcept {
+    V const *const value = find(key);
+    if (value == nullptr) {
+      ::estd::abort();
+    }
+    return *value;
+  }
+
+  /**
+   * @brief inserts key and value if key does not exist, abort when full
+   * @return bool: true if inserted, false if key already exists and value is not changed
+   */
+  bool insert(K const &key, V const &value) noexcept {
+    if (search(key) != kNotFound) {
+      return false;
+    }
+    place(key, value);
+    return true;
+  }
+  /**
+   * @brief inserts key and value, or assigns value if key exists, abort when full
+   * @return bool: true if inserted, false if assigned
+   */
+  bool insert_or_assign(K const &key, V const &value) noexcept {
+    size_type const slot = search(key);
+    if (slot != kNotFound) {
+      values_[slot] = value;
+      return false;
+    }
+    place(key, value);
+    return true;
+  }
+  /**
+   * @brief returns the value mapped to key, inserts a value initialized one if key does not exist
+   */
+  V &operator[](K const &key) noexcept {
+    size_type const slot = search(key);
+    if (slot != kNotFound) {
+      return values_[slot];
+    }
+    return values_[place(key, V{})];
+  }
+  /**
+   * @brief removes the element with key, following elements of the probe sequence are shifted back
+   * @return size_type: number of removed elements, 0 or 1
+   */
+  size_type erase(K const &key) noexcept {
+    size_type slot = search(key);
+    if (slot == kNotFound) {
+      return 0U;
+    }
+    size_type next = (slot + 1U) & kMask;
+    while (metadata_[next] != kEmpty && distance(metadata_[next]) != 0U) {
+      metadata_[slot] = static_cast<metadata_type>(metadata_[next] - 1U);
+      keys_[slot] = ::estd::move(keys_[next]);
+      values_[slot] = ::estd::move(values_[next]);
+      slot = next;
+      next = (next + 1U) & kMask;
+    }
+    metadata_[slot] = kEmpty;
+    --size_;
+    return 1U;
+  }
+
+  /**
+   * @brief calls fn(key, value) for every element in unspecified order
+   */
+  template <class Fn> void for_each(Fn &&fn) {
+    for (size_type i = 0U; i < N; ++i) {
+      if (metadata_[i] != kEmpty) {
+        fn(static_cast<K const &>(keys_[i]), values_[i]);
+      }
+    }
+  }
+
+private:
+  // low byte is probe distance + 1 and 0 means empty, high byte is hash fragment
+  using metadata_type = unsigned short;
+  static constexpr metadata_type kEmpty = 0U;
+  static constexpr metadata_type kDistanceMask = 0xFFU;
+  static constexpr size_type kMask = N - 1U;
+  static constexpr size_type kNotFound = N;
+
+  static constexpr size_type distance(metadata_type metadata) noexcept {
+    return static_cast<size_type>((metadata & kDistanceMask) - 1U);
+  }
+  // metadata of key at its home slot
+  static metadata_type home_metadata(size_type hash) noexcept {
+    return static_cast<metadata_type>(((hash >> (sizeof(size_type) * 8U - 8U)) << 8U) | 1U);
+  }
+
+  size_type search(K const &key) const noexcept {
+    size_type const hash = Hash{}(key);
+    metadata_type expected = home_metadata(hash);
+    size_type slot = hash & kMask;
+    while (true) {
+      metadata_type const metadata = metadata_[slot];
+      if (metadata == expected && KeyEqual{}(keys_[slot], key)) {
+        return slot;
+      }
+      // Robin Hood invariant: key would have displaced an element closer to its home
+      if ((metadata & kDistanceMask) < (expected & kDistanceMask)) {
+        return kNotFound;
+      }
+      slot = (slot + 1U) & kMask;
+      ++expected;
+    }
+  }
+
+  // inserts key which does not exist, returns its slot
+  template <class Value> size_type place(K const &key, Value &&value) noexcept {
+    if (size_ == N) {
+      ::estd::abort();
+    }
+    size_type const hash = Hash{}(key);
+    metadata_type metadata = home_metadata(hash);
+    size_type slot = hash & kMask;
+    K carried_key = key;
+    V carried_value = ::estd::forward<Value>(value);
+    size_type result = kNotFound;
+    while (true) {
+      if (metadata_[slot] == kEmpty) {
+        metadata_[slot] = metadata;
+        keys_[slot] = ::estd::move(carried_key);
+        values_[slot] = ::estd::move(carried_value);
+        ++size_;
+        return result == kNotFound ? slot : result;
+      }
+      if ((metadata_[slot] & kDistanceMask) < (metadata & kDistanceMask)) {
+        // take the slot from the richer element and carry it on
+        ::estd::swap(metadata, metadata_[slot]);
+        ::estd::swap(carried_key, keys_[slot]);
+        ::estd::swap(carried_value, values_[slot]);
+        result = result == kNotFound ? slot : result;
+      }
+      slot = (slot + 1U) & kMask;
+      ++metadata;
+      // keep distance below 0xFF so that search always stops
+      if ((metadata & kDistanceMask) == kDistanceMask) {
+        ::estd::abort();
+      }
+    }
+  }
+
+  ::estd::Array<metadata_type, N> metadata_;
+  ::estd::Array<K, N> keys_;
+  ::estd::Array<V, N> values_;
+  size_type size_;
+};
+
+}; // namespace estd
+
+#endif
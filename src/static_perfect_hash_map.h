@@ -0,0 +1,255 @@
+/**
+ * @File Name: static_perfect_hash_map.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__static_perfect_hash_map__
+#define __estd__static_perfect_hash_map__
+
+#include "abort.h"
+#include "algorithm.h"
+#include "array.h"
+#include "hash.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+namespace detail {
+
+template <class K, bool = ::estd::is_integral<K>::value> struct StaticPerfectHashTraitsImpl {};
+template <class K> struct StaticPerfectHashTraitsImpl<K, true> {
+  static constexpr unsigned long long hash(K key, unsigned long long seed) noexcept {
+    return ::estd::hash_mix(static_cast<unsigned long long>(key) ^ seed);
+  }
+  static constexpr bool equal(K lhs, K rhs) noexcept { return lhs == rhs; }
+};
+
+// orders buckets by descending size, so that the largest buckets are placed while most slots are free
+struct PerfectHashBucketGreater {
+  ::estd::size_t const *offsets;
+  constexpr bool operator()(::estd::size_t lhs, ::estd::size_t rhs) const noexcept {
+    return offsets[lhs + 1U] - offsets[lhs] > offsets[rhs + 1U] - offsets[rhs];
+  }
+};
+
+}; // namespace detail
+
+/**
+ * @brief seeded hash and equality of StaticPerfectHashMap keys, both usable in constant expressions. Integers and
+ * null terminated strings are supported, specialize it for other types.
+ */
+template <class K> struct StaticPerfectHashTraits : ::estd::detail::StaticPerfectHashTraitsImpl<K> {};
+template <> struct StaticPerfectHashTraits<char const *> {
+  // FNV-1a started from seed, then mixed so that the low bits used as bucket depend on every character
+  static constexpr unsigned long long hash(char const *key, unsigned long long seed) noexcept {
+    unsigned long long hash = 0xCBF29CE484222325ULL ^ seed;
+    for (; *key != '\0'; ++key) {
+      hash = (hash ^ static_cast<unsigned char>(*key)) * 0x100000001B3ULL;
+    }
+    return ::estd::hash_mix(hash);
+  }
+  static constexpr bool equal(char const *lhs, char const *rhs) noexcept {
+    for (; *lhs != '\0' && *lhs == *rhs; ++lhs, ++rhs) {
+    }
+    return *lhs == *rhs;
+  }
+};
+
+template <class K, class V> struct StaticPerfectHashMapEntry {
+  K key;
+  V value;
+};
+
+/**
+ * @brief immutable hash map whose content is known at compile time. The constructor builds a perfect hash by hash and
+ * displace: keys are grouped into buckets by their hash, then every bucket from the largest one gets the first
+ * displacement which moves all its keys into free slots. A lookup is one key hash, one displacement and one slot read
+ * and one key compare. Constructed as a constexpr variable, the whole table is emitted as read only data.
+ * Unused slots hold a copy of another entry, whose key can never be equal to a key hashed into that slot.
+ * @tparam K key type, must be a literal type when constructed in constant expression
+ * @tparam V mapped type, must be a literal type when constructed in constant expression
+ * @tparam N number of entries
+ * @tparam Traits seeded hash and key equality, see estd::StaticPerfectHashTraits
+ */
+template <class K, class V, ::estd::size_t N, class Traits = ::estd::StaticPerfectHashTraits<K>>
+class StaticPerfectHashMap {
+  static_assert(N >= 1U, "StaticPerfectHashMap must have at least one entry");
+
+public:
+  using key_type = K;
+  using mapped_type = V;
+  using value_type = ::estd::StaticPerfectHashMapEntry<K, V>;
+  using size_type = ::estd::size_t;
+
+  /**
+   * @brief builds the perfect hash of entries, abort if a key is duplicated, which fails the constant evaluation
+   * @param  entries: key value pairs
+   */
+  constexpr explicit StaticPerfectHashMap(value_type const (&entries)[N]) : seed_{0U}, pilots_{}, slots_{} {
+    build(entries);
+  }
+  constexpr explicit StaticPerfectHashMap(::estd::Array<value_type, N> const &entries)
+      : seed_{0U}, pilots_{}, slots_{} {
+    build(entries.data());
+  }
+
+  static constexpr size_type size() noexcept { return N; }
+  /**
+   * @brief returns the number of slots, load factor is between 0.4 and 0.8
+   */
+  static constexpr size_type slot_count() noexcept { return kSlotCount; }
+  static constexpr size_type bucket_count() noexcept { return kBucketCount; }
+
+  /**
+   * @brief returns the value mapped to key, nullptr if key is not found
+   */
+  constexpr V const *find(K const &key) const noexcept {
+    unsigned long long const hash = Traits::hash(key, seed_);
+    value_type const &entry = slots_[slot(hash, pilots_[bucket(hash)])];
+    return Traits::equal(entry.key, key) ? &entry.value : nullptr;
+  }
+  constexpr bool contains(K const &key) const noexcept { return find(key) != nullptr; }
+  /**
+   * @brief returns the value mapped to key, abort if key is not found
+   */
+  constexpr V const &at(K const &key) const noexcept {
+    V const *const value = find(key);
+    if (value == nullptr) {
+      ::estd::abort();
+    }
+    return *value;
+  }
+
+private:
+  using pilot_type = unsigned short;
+  // average bucket holds at most 4 keys
+  static constexpr size_type kBucketCount = ::estd::detail::bit_ceil(N / 4U + 1U);
+  static constexpr size_type kSlotCount = ::estd::detail::bit_ceil(N + N / 4U + 1U);
+  static constexpr unsigned kSlotShift = 65U - static_cast<unsigned>(::estd::detail::bit_width(kSlotCount));
+  static constexpr unsigned long long kMaxPilot = 0xFFFFU;
+  static constexpr unsigned long long kMaxSeed = 16U;
+
+  static constexpr size_type bucket(unsigned long long hash) noexcept {
+    return static_cast<size_type>(hash) & (kBucketCount - 1U);
+  }
+  // multiplicative hashing, the high bits of the product depend on every bit of hash and pilot
+  static constexpr size_type slot(unsigned long long hash, unsigned long long pilot) noexcept {
+    return static_cast<size_type>(((hash ^ (pilot * 0xC2B2AE3D27D4EB4FULL)) * 0x9E3779B97F4A7C15ULL) >> kSlotShift);
+  }
+
+  constexpr void build(value_type const *entries) noexcept {
+    for (unsigned long long seed = 0U; seed < kMaxSeed; ++seed) {
+      seed_ = ::estd::hash_mix(seed);
+      if (try_build(entries)) {
+        return;
+      }
+    }
+    ::estd::abort();
+  }
+
+  // places every bucket with the current seed, false if a bucket cannot be placed by any pilot
+  constexpr bool try_build(value_type const *entries) noexcept {
+    ::estd::Array<unsigned long long, N> hashes{};
+    ::estd::Array<size_type, kBucketCount + 1U> offsets{};
+    for (size_type i = 0U; i < N; ++i) {
+      hashes[i] = Traits::hash(entries[i].key, seed_);
+      ++offsets[bucket(hashes[i]) + 1U];
+    }
+    for (size_type b = 0U; b < kBucketCount; ++b) {
+      offsets[b + 1U] += offsets[b];
+    }
+    // indexes of entries grouped by bucket
+    ::estd::Array<size_type, N> members{};
+    ::estd::Array<size_type, kBucketCount> cursors{};
+    for (size_type b = 0U; b < kBucketCount; ++b) {
+      cursors[b] = offsets[b];
+    }
+    for (size_type i = 0U; i < N; ++i) {
+      members[cursors[bucket(hashes[i])]++] = i;
+    }
+    ::estd::Array<size_type, kBucketCount> order{};
+    for (size_type b = 0U; b < kBucketCount; ++b) {
+      order[b] = b;
+    }
+    ::estd::sort(order.begin(), order.end(), ::estd::detail::PerfectHashBucketGreater{offsets.data()});
+
+    ::estd::Array<bool, kSlotCount> taken{};
+    for (size_type const b : order) {
+      size_type const first = offsets[b];
+      size_type const last = offsets[b + 1U];
+      check_unique(entries, hashes, members, first, last);
+      unsigned long long pilot = 0U;
+      while (!fits(hashes, members, taken, first, last, pilot)) {
+        if (pilot == kMaxPilot) {
+          return false;
+        }
+        ++pilot;
+      }
+      pilots_[b] = static_cast<pilot_type>(pilot);
+      for (size_type m = first; m < last; ++m) {
+        size_type const s = slot(hashes[members[m]], pilot);
+        taken[s] = true;
+        slots_[s] = entries[members[m]];
+      }
+    }
+    for (size_type s = 0U; s < kSlotCount; ++s) {
+      if (!taken[s]) {
+        slots_[s] = entries[0U];
+      }
+    }
+    return true;
+  }
+
+  // a duplicated key has the same slot for every pilot, reject it before searching
+  static constexpr void check_unique(value_type const *entries, ::estd::Array<unsigned long long, N> const &hashes,
+                                     ::estd::Array<size_type, N> const &members, size_type first,
+                                     size_type last) noexcept {
+    for (size_type i = first; i < last; ++i) {
+      for (size_type j = i + 1U; j < last; ++j) {
+        if (hashes[members[i]] == hashes[members[j]] &&
+            Traits::equal(entries[members[i]].key, entries[members[j]].key)) {
+          ::estd::abort();
+        }
+      }
+    }
+  }
+
+  // whether all keys of bucket land in distinct free slots with pilot
+  static constexpr bool fits(::estd::Array<unsigned long long, N> const &hashes,
+                             ::estd::Array<size_type, N> const &members,
+                             ::estd::Array<bool, kSlotCount> const &taken, size_type first, size_type last,
+                             unsigned long long pilot) noexcept {
+    for (size_type i = first; i < last; ++i) {
+      size_type const s = slot(hashes[members[i]], pilot);
+      if (taken[s]) {
+        return false;
+      }
+      for (size_type j = first; j < i; ++j) {
+        if (slot(hashes[members[j]], pilot) == s) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  unsigned long long seed_;
+  ::estd::Array<pilot_type, kBucketCount> pilots_;
+  ::estd::Array<value_type, kSlotCount> slots_;
+};
+
+/**
+ * @brief creates StaticPerfectHashMap from key value pairs, the number of entries is deduced
+ */
+template <class K, class V, class Traits = ::estd::StaticPerfectHashTraits<K>, ::estd::size_t N>
+constexpr ::estd::StaticPerfectHashMap<K, V, N, Traits>
+make_static_perfect_hash_map(::estd::StaticPerfectHashMapEntry<K, V> const (&entries)[N]) {
+  return ::estd::StaticPerfectHashMap<K, V, N, Traits>{entries};
+}
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,239 @@
+/**
+ * @File Name: static_string.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__static_string__
+#define __estd__static_string__
+
+#include "abort.h"
+#include "charconv.h"
+#include "memory.h"
+#include "string_view.h"
+#include "type.h"
+#include "type_traits.h"
+
+namespace estd {
+
+namespace detail {
+
+// short string keeps the remaining capacity in its last byte, which is also the terminating null character when full
+template <::estd::size_t N, bool = (N <= 0xFFU)> class StaticStringStorage {
+protected:
+  StaticStringStorage() noexcept { set_size(0U); }
+
+  ::estd::size_t get_size() const noexcept { return N - static_cast<unsigned char>(data_[N]); }
+  void set_size(::estd::size_t size) noexcept {
+    data_[size] = '\0';
+    data_[N] = static_cast<char>(N - size);
+  }
+
+  char data_[N + 1U];
+};
+template <::estd::size_t N> class StaticStringStorage<N, false> {
+protected:
+  StaticStringStorage() noexcept { set_size(0U); }
+
+  ::estd::size_t get_size() const noexcept { return size_; }
+  void set_size(::estd::size_t size) noexcept {
+    data_[size] = '\0';
+    size_ = size;
+  }
+
+  char data_[N + 1U];
+  ::estd::size_t size_;
+};
+
+}; // namespace detail
+
+/**
+ * @brief null terminated string with fixed capacity N and inline storage, it never allocates. Up to 255 characters
+ * the length is stored in place of the last byte, so sizeof(StaticString<N>) is N + 1. Growing beyond N aborts.
+ * Searching and slicing are done by StringView without copying.
+ * @tparam N capacity, not including the terminating null character
+ */
+template <::estd::size_t N> class StaticString : private ::estd::detail::StaticStringStorage<N> {
+  using Storage = ::estd::detail::StaticStringStorage<N>;
+
+public:
+  using value_type = char;
+  using size_type = ::estd::size_t;
+  using difference_type = ::estd::ptrdiff_t;
+  using reference = char &;
+  using const_reference = char const &;
+  using pointer = char *;
+  using const_pointer = char const *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  static constexpr size_type npos = ::estd::StringView::npos;
+
+  StaticString() noexcept = default;
+  StaticString(const_pointer str) noexcept { append(::estd::StringView{str}); }
+  explicit StaticString(::estd::StringView str) noexcept { append(str); }
+  StaticString(size_type count, char ch) noexcept { append(count, ch); }
+
+  /**
+   * @brief replaces the content with str, which may view this string. Abort when str exceeds the capacity.
+   */
+  StaticString &operator=(::estd::StringView str) noexcept {
+    // str is copied before the size is written, the terminator and the in place size would overwrite a view of this
+    check_capacity(0U, str.size());
+    if (!str.empty()) {
+      ::estd::memmove(data(), str.data(), str.size());
+    }
+    this->set_size(str.size());
+    return *this;
+  }
+
+  /**
+   * @brief views the content without copying
+   */
+  operator ::estd::StringView() const noexcept { return ::estd::StringView{data(), size()}; }
+
+  reference operator[](size_type pos) noexcept { return this->data_[pos]; }
+  const_reference operator[](size_type pos) const noexcept { return this->data_[pos]; }
+  /**
+   * @brief access specified character with bounds checking(abort)
+   */
+  reference at(size_type pos) noexcept {
+    this->check(pos);
+    return this->data_[pos];
+  }
+  const_reference at(size_type pos) const noexcept {
+    this->check(pos);
+    return this->data_[pos];
+  }
+  reference front() noexcept { return this->data_[0]; }
+  const_reference front() const noexcept { return this->data_[0]; }
+  reference back() noexcept { return this->data_[size() - 1U]; }
+  const_reference back() const noexcept { return this->data_[size() - 1U]; }
+
+  pointer data() noexcept { return &this->data_[0]; }
+  const_pointer data() const noexcept { return &this->data_[0]; }
+  /**
+   * @brief returns the content as null terminated string
+   */
+  const_pointer c_str() const noexcept { return &this->data_[0]; }
+
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator cbegin() const noexcept { return data(); }
+  iterator end() noexcept { return data() + size(); }
+  const_iterator end() const noexcept { return data() + size(); }
+  const_iterator cend() const noexcept { return data() + size(); }
+
+  bool empty() const noexcept { return size() == 0U; }
+  bool full() const noexcept { return size() == N; }
+  size_type size() const noexcept { return this->get_size(); }
+  size_type length() const noexcept { return this->get_size(); }
+  static constexpr size_type max_size() noexcept { return N; }
+  static constexpr size_type capacity() noexcept { return N; }
+
+  void clear() noexcept { this->set_size(0U); }
+  /**
+   * @brief resizes to count characters, new characters are ch. Abort when count is greater than N.
+   */
+  void resize(size_type count, char ch = '\0') noexcept {
+    size_type const size = this->size();
+    if (count > size) {
+      append(count - size, ch);
+    } else {
+      this->set_size(count);
+    }
+  }
+  /**
+   * @brief appends ch. Abort when full.
+   */
+  void push_back(char ch) noexcept {
+    size_type const size = this->size();
+    check_capacity(size, 1U);
+    this->data_[size] = ch;
+    this->set_size(size + 1U);
+  }
+  /**
+   * @brief removes the last character, calling pop_back on an empty string results in undefined behavior
+   */
+  void pop_back() noexcept { this->set_size(size() - 1U); }
+
+  /**
+   * @brief appends str. Abort when the result exceeds the capacity.
+   * @return StaticString&: *this
+   */
+  StaticString &append(::estd::StringView str) noexcept {
+    size_type const size = this->size();
+    check_capacity(size, str.size());
+    if (!str.empty()) {
+      ::estd::memmove(data() + size, str.data(), str.size());
+    }
+    this->set_size(size + str.size());
+    return *this;
+  }
+  /**
+   * @brief appends count copies of ch. Abort when the result exceeds the capacity.
+   * @return StaticString&: *this
+   */
+  StaticString &append(size_type count, char ch) noexcept {
+    size_type const size = this->size();
+    check_capacity(size, count);
+    ::estd::memset(data() + size, ch, count);
+    this->set_size(size + count);
+    return *this;
+  }
+  /**
+   * @brief appends value in decimal, see estd::to_chars. Abort when the result exceeds the capacity.
+   * @return StaticString&: *this
+   */
+  template <class T> StaticString &append_integer(T value) noexcept {
+    size_type const size = this->size();
+    char *const last = ::estd::to_chars(data() + size, data() + N, value);
+    if (last == nullptr) {
+      ::estd::abort();
+    }
+    this->set_size(static_cast<size_type>(last - data()));
+    return *this;
+  }
+  StaticString &operator+=(::estd::StringView str) noexcept { return append(str); }
+  StaticString &operator+=(char ch) noexcept {
+    push_back(ch);
+    return *this;
+  }
+
+  /**
+   * @brief returns a view of [pos, pos + count) without copying, abort if pos is greater than size
+   */
+  ::estd::StringView substr(size_type pos, size_type count = npos) const noexcept {
+    return ::estd::StringView{*this}.substr(pos, count);
+  }
+  int compare(::estd::StringView other) const noexcept { return ::estd::StringView{*this}.compare(other); }
+  bool starts_with(::estd::StringView prefix) const noexcept { return ::estd::StringView{*this}.starts_with(prefix); }
+  bool ends_with(::estd::StringView suffix) const noexcept { return ::estd::StringView{*this}.ends_with(suffix); }
+  size_type find(char ch, size_type pos = 0U) const noexcept { return ::estd::StringView{*this}.find(ch, pos); }
+  size_type find(::estd::StringView needle, size_type pos = 0U) const noexcept {
+    return ::estd::StringView{*this}.find(needle, pos);
+  }
+  size_type find_first_of(::estd::StringView set, size_type pos = 0U) const noexcept {
+    return ::estd::StringView{*this}.find_first_of(set, pos);
+  }
+  template <class T> bool to_integer(T &value) const noexcept { return ::estd::StringView{*this}.to_integer(value); }
+
+private:
+  void check(size_type pos) const noexcept {
+    if (pos >= size()) {
+      ::estd::abort();
+    }
+  }
+  static void check_capacity(size_type size, size_type count) noexcept {
+    if (count > N - size) {
+      ::estd::abort();
+    }
+  }
+};
+
+template <::estd::size_t N> constexpr ::estd::size_t StaticString<N>::npos;
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,337 @@
+/**
+ * @File Name: static_vector.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__static_vector__
+#define __estd__static_vector__
+
+#include "abort.h"
+#include "memory.h"
+#include "type.h"
+#include "type_traits.h"
+#include "utility.h"
+
+namespace estd {
+
+/**
+ * @brief sequence container with fixed capacity N and runtime size. Elements are stored in uninitialized inline
+ * storage, only live elements are constructed or destroyed.
+ * @tparam T element type
+ * @tparam N capacity
+ */
+template <class T, ::estd::size_t N> class StaticVector {
+public:
+  using value_type = T;
+  using size_type = ::estd::size_t;
+  using difference_type = ::estd::ptrdiff_t;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using pointer = value_type *;
+  using const_pointer = const value_type *;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+
+  StaticVector() noexcept : size_{0U} {}
+  /**
+   * @brief constructs with one element, explicit so that a value does not convert to StaticVector
+   */
+  template <class _Tp, class = typename ::estd::enable_if<
+                           !::estd::is_same<typename ::estd::remove_cvref<_Tp>::type, StaticVector>::value>::type>
+  explicit StaticVector(_Tp &&value) : size_{0U} {
+    static_assert(N > 0U, "too many initializers for StaticVector");
+    init(::estd::forward<_Tp>(value));
+  }
+  /**
+   * @brief constructs with the given elements
+   */
+  template <class _Tp, class _Up, class... _Args>
+  StaticVector(_Tp &&value, _Up &&next, _Args &&...args) : size_{0U} {
+    static_assert(sizeof...(_Args) + 1U < N, "too many initializers for StaticVector");
+    init(::estd::forward<_Tp>(value), ::estd::forward<_Up>(next), ::estd::forward<_Args>(args)...);
+  }
+  StaticVector(StaticVector const &other) : size_{0U} {
+    copy_construct(other.data(), other.size(), ::estd::is_trivially_copyable<T>{});
+  }
+  StaticVector(StaticVector &&other) noexcept(::estd::is_nothrow_move_constructible<T>::value) : size_{0U} {
+    move_construct(other.data(), other.size(), ::estd::is_trivially_copyable<T>{});
+  }
+  StaticVector &operator=(StaticVector const &other) {
+    if (this != &other) {
+      clear();
+      copy_construct(other.data(), other.size(), ::estd::is_trivially_copyable<T>{});
+    }
+    return *this;
+  }
+  StaticVector &operator=(StaticVector &&other) noexcept(::estd::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      clear();
+      move_construct(other.data(), other.size(), ::estd::is_trivially_copyable<T>{});
+    }
+    return *this;
+  }
+  ~StaticVector() { clear(); }
+
+  /**
+   * @brief access specified element
+   * @param  pos: specified location pos
+   * @return reference: specified element
+   */
+  reference operator[](size_type pos) noexcept { return data()[pos]; }
+  const_reference operator[](size_type pos) const noexcept { return data()[pos]; }
+
+  /**
+   * @brief access specified element with bounds checking(abort)
+   * @param  pos: specified location pos
+   * @return reference: specified element
+   */
+  reference at(size_type pos) noexcept {
+    this->check(pos);
+    return data()[pos];
+  }
+  const_reference at(size_type pos) const noexcept {
+    this->check(pos);
+    return data()[pos];
+  }
+
+  /**
+   * @brief access the first element
+   * @return reference: first element
+   */
+  reference front() noexcept { return data()[0]; }
+  const_reference front() const noexcept { return data()[0]; }
+
+  /**
+   * @brief access the last element
+   * @return reference: last element
+   */
+  reference back() noexcept { return data()[size_ - 1U]; }
+  const_reference back() const noexcept { return data()[size_ - 1U]; }
+
+  /**
+   * @brief direct access to the underlying storage
+   * @return pointer: underlying storage pointer
+   */
+  pointer data() noexcept { return reinterpret_cast<pointer>(&storage_[0]); }
+  const_pointer data() const noexcept { return reinterpret_cast<const_pointer>(&storage_[0]); }
+
+  iterator begin() noexcept { return data(); }
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator cbegin() const noexcept { return data(); }
+
+  iterator end() noexcept { return data() + size_; }
+  const_iterator end() const noexcept { return data() + size_; }
+  const_iterator cend() const noexcept { return data() + size_; }
+
+  /**
+   * @brief checks whether the container is empty
+   * @return true: container is empty
+   * @return false: container is not empty
+   */
+  bool empty() const noexcept { return size_ == 0U; }
+  /**
+   * @brief checks whether the container is full
+   * @return true: container is full
+   * @return false: container is not full
+   */
+  bool full() const noexcept { return size_ == N; }
+  /**
+   * @brief returns the number of elements
+   * @return size_type: number of elements
+   */
+  size_type size() const noexcept { return size_; }
+  /**
+   * @brief returns the maximum possible number of elements
+   * @return size_type: maximum possible number of elements
+   */
+  size_type max_size() const noexcept { return N; }
+  /**
+   * @brief returns the number of elements that can be held in storage
+   * @return size_type: capacity of storage
+   */
+  size_type capacity() const noexcept { return N; }
+
+  /**
+   * @brief Erases all elements from the container.
+   */
+  void clear() noexcept {
+    destroy(begin(), end(), ::estd::is_trivially_destructible<T>{});
+    size_ = 0U;
+  }
+
+  /**
+   * @brief Appends the given element value to the end of the container. Abort when container is full.
+   * @param value the value of the element to append
+   */
+  void push_back(const_reference value) { emplace_back(value); }
+  void push_back(value_type &&value) { emplace_back(::estd::move(value)); }
+
+  /**
+   * @brief Appends a new element constructed in-place from args to the end of the container. Abort when container is
+   * full.
+   * @param args arguments to forward to the constructor of the element
+   * @return reference: the inserted element
+   */
+  template <class... Args> reference emplace_back(Args &&...args) {
+    check_capacity();
+    pointer const element = ::estd::construct_at(end(), ::estd::forward<Args>(args)...);
+    ++size_;
+    return *element;
+  }
+
+  /**
+   * @brief Removes the last element of the container. Calling pop_back on an empty container results in undefined
+   * behavior.
+   */
+  void pop_back() noexcept {
+    --size_;
+    ::estd::destroy_at(end());
+  }
+
+  /**
+   * @brief inserts value before pos. Abort when container is full.
+   * @param pos iterator before which the content will be inserted. pos may be the end() iterator
+   * @param value element value to insert
+   * @return iterator: Iterator pointing to the inserted value.
+   */
+  iterator insert(const_iterator pos, const_reference value) { return emplace(pos, value); }
+  iterator insert(const_iterator pos, value_type &&value) { return emplace(pos, ::estd::move(value)); }
+
+  /**
+   * @brief Inserts a new element constructed in-place from args before pos. Abort when container is full.
+   * @param pos iterator before which the new element will be constructed
+   * @param args arguments to forward to the constructor of the element
+   * @return iterator: Iterator pointing to the emplaced element.
+   */
+  template <class... Args> iterator emplace(const_iterator pos, Args &&...args) {
+    check_capacity();
+    iterator const position = begin() + (pos - cbegin());
+    if (position == end()) {
+      ::estd::construct_at(position, ::estd::forward<Args>(args)...);
+    } else {
+      // construct first, args may refer to an element which will be shifted
+      value_type value(::estd::forward<Args>(args)...);
+      shift_right(position, ::estd::is_trivially_copyable<T>{});
+      *position = ::estd::move(value);
+    }
+    ++size_;
+    return position;
+  }
+
+  /**
+   * @brief Removes the element at pos.
+   * @param pos iterator to the element to remove
+   * @return iterator: Iterator following the removed element.
+   */
+  iterator erase(const_iterator pos) noexcept { return erase(pos, pos + 1); }
+  /**
+   * @brief Removes the elements in the range [first, last).
+   * @param first begin of range of elements to remove
+   * @param last end of range of elements to remove
+   * @return iterator: Iterator following the last removed element.
+   */
+  iterator erase(const_iterator first, const_iterator last) noexcept {
+    iterator const position = begin() + (first - cbegin());
+    size_type const count = static_cast<size_type>(last - first);
+    if (count != 0U) {
+      shift_left(position, count, ::estd::is_trivially_copyable<T>{});
+      size_ -= count;
+    }
+    return position;
+  }
+
+private:
+  template <class _Tp, class... _Args> void init(_Tp &&value, _Args &&...args) {
+    emplace_back(::estd::forward<_Tp>(value));
+    init(::estd::forward<_Args>(args)...);
+  }
+  void init() noexcept {}
+
+  void copy_construct(const_pointer src, size_type count, ::estd::true_type) noexcept {
+    ::estd::memcpy(data(), src, count * sizeof(value_type));
+    size_ = count;
+  }
+  void copy_construct(const_pointer src, size_type count, ::estd::false_type) {
+    for (size_type i = 0U; i < count; ++i) {
+      emplace_back(src[i]);
+    }
+  }
+  void move_construct(pointer src, size_type count, ::estd::true_type) noexcept {
+    copy_construct(src, count, ::estd::true_type{});
+  }
+  void move_construct(pointer src, size_type count, ::estd::false_type) {
+    for (size_type i = 0U; i < count; ++i) {
+      emplace_back(::estd::move(src[i]));
+    }
+  }
+
+  static void destroy(iterator, iterator, ::estd::true_type) noexcept {}
+  static void destroy(iterator first, iterator last, ::estd::false_type) noexcept {
+    for (; first != last; ++first) {
+      ::estd::destroy_at(first);
+    }
+  }
+
+  // make room at position, [position, end()) is moved one element right.
+  void shift_right(iterator position, ::estd::true_type) noexcept {
+    ::estd::memmove(position + 1, position, static_cast<size_type>(end() - position) * sizeof(value_type));
+  }
+  void shift_right(iterator position, ::estd::false_type) {
+    iterator last = end();
+    ::estd::construct_at(last, ::estd::move(*(last - 1)));
+    for (--last; last != position; --last) {
+      *last = ::estd::move(*(last - 1));
+    }
+  }
+
+  // remove count elements at position, [position + count, end()) is moved left.
+  void shift_left(iterator position, size_type count, ::estd::true_type) noexcept {
+    ::estd::memmove(position, position + count,
+                    static_cast<size_type>(end() - (position + count)) * sizeof(value_type));
+  }
+  void shift_left(iterator position, size_type count, ::estd::false_type) noexcept {
+    iterator const last = end();
+    for (iterator it = position + count; it != last; ++it, ++position) {
+      *position = ::estd::move(*it);
+    }
+    destroy(position, last, ::estd::false_type{});
+  }
+
+  void check(size_type pos) const noexcept {
+    if (pos >= size_) {
+      ::estd::abort();
+    }
+  }
+  void check_capacity() const noexcept {
+    if (size_ >= N) {
+      ::estd::abort();
+    }
+  }
+
+private:
+  alignas(value_type) unsigned char storage_[sizeof(value_type) * (N == 0U ? 1U : N)];
+  size_type size_;
+};
+
+template <class T, ::estd::size_t N>
+bool operator==(const StaticVector<T, N> &lhs, const StaticVector<T, N> &rhs) noexcept {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  for (typename StaticVector<T, N>::size_type i = 0; i < lhs.size(); ++i) {
+    if (lhs[i] != rhs[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+template <class T, ::estd::size_t N>
+bool operator!=(const StaticVector<T, N> &lhs, const StaticVector<T, N> &rhs) noexcept {
+  return !(lhs == rhs);
+}
+
+}; // namespace estd
+
+#endif
@@ -0,0 +1,394 @@
+/**
+ * @File Name: string_view.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__string_view__
+#define __estd__string_view__
+
+#include "abort.h"
+#include "charconv.h"
+#include "memory.h"
+#include "type.h"
+#include "type_traits.h"
+
+// define ESTD_DISABLE_SIMD to force the scalar search
+#if defined(ESTD_DISABLE_SIMD)
+#define ESTD_SIMD_SEARCH 0
+#elif defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#define ESTD_SIMD_SEARCH 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define ESTD_SIMD_SEARCH 1
+#else
+#define ESTD_SIMD_SEARCH 0
+#endif
+
+namespace estd {
+
+namespace detail {
+
+#if ESTD_SIMD_SEARCH
+
+#if defined(__AVX2__)
+using SimdVector = __m256i;
+constexpr ::estd::size_t kSimdWidth = 32U;
+inline SimdVector simd_load(char const *p) noexcept {
+  return _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p));
+}
+inline SimdVector simd_splat(char value) noexcept { return _mm256_set1_epi8(value); }
+inline SimdVector simd_equal(SimdVector lhs, SimdVector rhs) noexcept { return _mm256_cmpeq_epi8(lhs, rhs); }
+inline SimdVector simd_or(SimdVector lhs, SimdVector rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+// index of the first matched byte, kSimdWidth if none
+inline ::estd::size_t simd_first(SimdVector match) noexcept {
+  unsigned const mask = static_cast<unsigned>(_mm256_movemask_epi8(match));
+  return mask == 0U ? kSimdWidth : static_cast<::estd::size_t>(__builtin_ctz(mask));
+}
+#elif defined(__SSE2__)
+using SimdVector = __m128i;
+constexpr ::estd::size_t kSimdWidth = 16U;
+inline SimdVector simd_load(char const *p) noexcept { return _mm_loadu_si128(reinterpret_cast<__m128i const *>(p)); }
+inline SimdVector simd_splat(char value) noexcept { return _mm_set1_epi8(value); }
+inline SimdVector simd_equal(SimdVector lhs, SimdVector rhs) noexcept { return _mm_cmpeq_epi8(lhs, rhs); }
+inline SimdVector simd_or(SimdVector lhs, SimdVector rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+inline ::estd::size_t simd_first(SimdVector match) noexcept {
+  unsigned const mask = static_cast<unsigned>(_mm_movemask_epi8(match));
+  return mask == 0U ? kSimdWidth : static_cast<::estd::size_t>(__builtin_ctz(mask));
+}
+#else
+using SimdVector = uint8x16_t;
+constexpr ::estd::size_t kSimdWidth = 16U;
+inline SimdVector simd_load(char const *p) noexcept { return vld1q_u8(reinterpret_cast<uint8_t const *>(p)); }
+inline SimdVector simd_splat(char value) noexcept { return vdupq_n_u8(static_cast<uint8_t>(value)); }
+inline SimdVector simd_equal(SimdVector lhs, SimdVector rhs) noexcept { return vceqq_u8(lhs, rhs); }
+inline SimdVector simd_or(SimdVector lhs, SimdVector rhs) noexcept { return vorrq_u8(lhs, rhs); }
+// NEON has no movemask, narrowing shift keeps 4 bits per byte
+inline ::estd::size_t simd_first(SimdVector match) noexcept {
+  unsigned long long const mask =
+      vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(match), 4)), 0);
+  return mask == 0U ? kSimdWidth : static_cast<::estd::size_t>(__builtin_ctzll(mask)) / 4U;
+}
+#endif
+
+#endif
+
+// sets up to this size are matched by comparing against each character, larger ones by a table
+constexpr ::estd::size_t kSmallCharSet = 8U;
+
+#if ESTD_SIMD_SEARCH
+
+struct SimdByteMatch {
+  SimdVector needle;
+  SimdVector operator()(SimdVector block) const noexcept { return ::estd::detail::simd_equal(block, needle); }
+};
+
+// scans whole blocks from pos, returns true with pos at the first match, otherwise pos is where the scalar tail starts
+template <class Match>
+inline bool simd_scan(char const *data, ::estd::size_t size, ::estd::size_t &pos, Match const &match) noexcept {
+  // four blocks are tested together, they are inspected one by one after a match
+  for (; pos + 4U * kSimdWidth <= size; pos += 4U * kSimdWidth) {
+    char const *const p = data + pos;
+    SimdVector const any = ::estd::detail::simd_or(
+        ::estd::detail::simd_or(match(::estd::detail::simd_load(p)), match(::estd::detail::simd_load(p + kSimdWidth))),
+        ::estd::detail::simd_or(match(::estd::detail::simd_load(p + 2U * kSimdWidth)),
+                                match(::estd::detail::simd_load(p + 3U * kSimdWidth))));
+    if (::estd::detail::simd_first(any) != kSimdWidth) {
+      break;
+    }
+  }
+  for (; pos + kSimdWidth <= size; pos += kSimdWidth) {
+    ::estd::size_t const index = ::estd::detail::simd_first(match(::estd::detail::simd_load(data + pos)));
+    if (index != kSimdWidth) {
+      pos += index;
+      return true;
+    }
+  }
+  return false;
+}
+
+// M needles, unused ones repeat the first character so that the compare loop has a fixed count
+template <::estd::size_t M> struct SimdSetMatch {
+  SimdVector needles[M];
+  SimdVector operator()(SimdVector block) const noexcept {
+    SimdVector result = ::estd::detail::simd_equal(block, needles[0]);
+    for (::estd::size_t i = 1U; i < M; ++i) {
+      result = ::estd::detail::simd_or(result, ::estd::detail::simd_equal(block, needles[i]));
+    }
+    return result;
+  }
+};
+template <::estd::size_t M>
+inline bool simd_scan_set(char const *data, ::estd::size_t size, ::estd::size_t &pos, char const *set,
+                          ::estd::size_t set_size) noexcept {
+  SimdSetMatch<M> match{};
+  for (::estd::size_t i = 0U; i < M; ++i) {
+    match.needles[i] = ::estd::detail::simd_splat(set[i < set_size ? i : 0U]);
+  }
+  return ::estd::detail::simd_scan(data, size, pos, match);
+}
+
+#endif
+
+/**
+ * @brief returns the position of the first value in [data, data + size), size if not found
+ */
+inline ::estd::size_t find_byte(char const *data, ::estd::size_t size, char value) noexcept {
+  ::estd::size_t pos = 0U;
+#if ESTD_SIMD_SEARCH
+  if (::estd::detail::simd_scan(data, size, pos, SimdByteMatch{::estd::detail::simd_splat(value)})) {
+    return pos;
+  }
+#endif
+  for (; pos < size; ++pos) {
+    if (data[pos] == value) {
+      return pos;
+    }
+  }
+  return size;
+}
+
+/**
+ * @brief returns the position of the first character in [data, data + size) which is one of [set, set + set_size),
+ * size if not found
+ */
+inline ::estd::size_t find_any(char const *data, ::estd::size_t size, char const *set,
+                               ::estd::size_t set_size) noexcept {
+  if (set_size == 1U) {
+    return ::estd::detail::find_byte(data, size, set[0]);
+  }
+  ::estd::size_t pos = 0U;
+  if (set_size <= kSmallCharSet) {
+#if ESTD_SIMD_SEARCH
+    bool const found = set_size <= 2U   ? ::estd::detail::simd_scan_set<2U>(data, size, pos, set, set_size)
+                       : set_size <= 4U ? ::estd::detail::simd_scan_set<4U>(data, size, pos, set, set_size)
+                                        : ::estd::detail::simd_scan_set<kSmallCharSet>(data, size, pos, set, set_size);
+    if (found) {
+      return pos;
+    }
+#endif
+    for (; pos < size; ++pos) {
+      for (::estd::size_t i = 0U; i < set_size; ++i) {
+        if (data[pos] == set[i]) {
+          return pos;
+        }
+      }
+    }
+    return size;
+  }
+  bool table[256] = {};
+  for (::estd::size_t i = 0U; i < set_size; ++i) {
+    table[static_cast<unsigned char>(set[i])] = true;
+  }
+  for (; pos < size; ++pos) {
+    if (table[static_cast<unsigned char>(data[pos])]) {
+      return pos;
+    }
+  }
+  return size;
+}
+
+// static data member of a template can be defined in header
+template <class T = void> struct StringViewConstants {
+  static constexpr ::estd::size_t npos = static_cast<::estd::size_t>(-1);
+};
+template <class T> constexpr ::estd::size_t StringViewConstants<T>::npos;
+
+}; // namespace detail
+
+/**
+ * @brief non-owning read only view of a character sequence, which is not required to be null terminated. Searching
+ * scans 16 or 32 bytes per step with SSE2, AVX2 or NEON when the target supports it.
+ */
+class StringView : public ::estd::detail::StringViewConstants<> {
+public:
+  using value_type = char;
+  using size_type = ::estd::size_t;
+  using difference_type = ::estd::ptrdiff_t;
+  using const_reference = char const &;
+  using const_pointer = char const *;
+  using const_iterator = const_pointer;
+  using iterator = const_iterator;
+
+  constexpr StringView() noexcept : data_{nullptr}, size_{0U} {}
+  constexpr StringView(const_pointer data, size_type size) noexcept : data_{data}, size_{size} {}
+  /**
+   * @brief views the null terminated string str without the terminating null character
+   */
+  constexpr StringView(const_pointer str) noexcept : data_{str}, size_{length_of(str)} {}
+
+  constexpr const_iterator begin() const noexcept { return data_; }
+  constexpr const_iterator cbegin() const noexcept { return data_; }
+  constexpr const_iterator end() const noexcept { return data_ + size_; }
+  constexpr const_iterator cend() const noexcept { return data_ + size_; }
+
+  constexpr const_reference operator[](size_type pos) const noexcept { return data_[pos]; }
+  /**
+   * @brief access specified character with bounds checking(abort)
+   */
+  constexpr const_reference at(size_type pos) const noexcept {
+    if (pos >= size_) {
+      ::estd::abort();
+    }
+    return data_[pos];
+  }
+  constexpr const_reference front() const noexcept { return data_[0]; }
+  constexpr const_reference back() const noexcept { return data_[size_ - 1U]; }
+  constexpr const_pointer data() const noexcept { return data_; }
+
+  constexpr size_type size() const noexcept { return size_; }
+  constexpr size_type length() const noexcept { return size_; }
+  constexpr bool empty() const noexcept { return size_ == 0U; }
+
+  /**
+   * @brief shrinks the view by moving its start forward by count characters
+   */
+  constexpr void remove_prefix(size_type count) noexcept {
+    data_ += count;
+    size_ -= count;
+  }
+  /**
+   * @brief shrinks the view by moving its end backward by count characters
+   */
+  constexpr void remove_suffix(size_type count) noexcept { size_ -= count; }
+
+  /**
+   * @brief returns a view of [pos, pos + count) without copying, abort if pos is greater than size
+   * @param  pos: position of the first character
+   * @param  count: requested length, clamped to the end of the view
+   * @return StringView: view of the substring
+   */
+  constexpr StringView substr(size_type pos, size_type count = npos) const noexcept {
+    if (pos > size_) {
+      ::estd::abort();
+    }
+    return StringView{data_ + pos, count < size_ - pos ? count : size_ - pos};
+  }
+
+  /**
+   * @brief compares two views lexicographically as unsigned char
+   * @return int: negative if this is less than other, zero if equal, positive if greater
+   */
+  constexpr int compare(StringView other) const noexcept {
+    size_type const common = size_ < other.size_ ? size_ : other.size_;
+    int const result = compare_n(data_, other.data_, common);
+    if (result != 0) {
+      return result;
+    }
+    return size_ == other.size_ ? 0 : (size_ < other.size_ ? -1 : 1);
+  }
+  constexpr bool starts_with(StringView prefix) const noexcept {
+    return size_ >= prefix.size_ && compare_n(data_, prefix.data_, prefix.size_) == 0;
+  }
+  constexpr bool ends_with(StringView suffix) const noexcept {
+    return size_ >= suffix.size_ && compare_n(data_ + size_ - suffix.size_, suffix.data_, suffix.size_) == 0;
+  }
+
+  /**
+   * @brief finds the first character equal to ch at or after pos
+   * @return size_type: position of the character, npos if not found
+   */
+  size_type find(char ch, size_type pos = 0U) const noexcept {
+    if (pos >= size_) {
+      return npos;
+    }
+    size_type const found = ::estd::detail::find_byte(data_ + pos, size_ - pos, ch);
+    return found == size_ - pos ? npos : pos + found;
+  }
+  /**
+   * @brief finds the first substring equal to needle at or after pos, candidates are located by searching the first
+   * character of needle
+   * @return size_type: position of the substring, npos if not found
+   */
+  size_type find(StringView needle, size_type pos = 0U) const noexcept {
+    if (needle.size_ == 0U) {
+      return pos <= size_ ? pos : npos;
+    }
+    while (pos < size_ && size_ - pos >= needle.size_) {
+      // only positions where the whole needle fits
+      size_type const window = size_ - pos - needle.size_ + 1U;
+      size_type const found = ::estd::detail::find_byte(data_ + pos, window, needle.data_[0]);
+      if (found == window) {
+        return npos;
+      }
+      pos += found;
+      if (::estd::memcmp(data_ + pos + 1U, needle.data_ + 1U, needle.size_ - 1U) == 0) {
+        return pos;
+      }
+      ++pos;
+    }
+    return npos;
+  }
+  /**
+   * @brief finds the first character equal to any character of set at or after pos
+   * @return size_type: position of the character, npos if not found
+   */
+  size_type find_first_of(StringView set, size_type pos = 0U) const noexcept {
+    if (pos >= size_ || set.size_ == 0U) {
+      return npos;
+    }
+    size_type const found = ::estd::detail::find_any(data_ + pos, size_ - pos, set.data_, set.size_);
+    return found == size_ - pos ? npos : pos + found;
+  }
+  size_type find_first_of(char ch, size_type pos = 0U) const noexcept { return find(ch, pos); }
+  bool contains(char ch) const noexcept { return find(ch) != npos; }
+  bool contains(StringView needle) const noexcept { return find(needle) != npos; }
+
+  /**
+   * @brief parses the whole view as a decimal integer, see estd::from_chars
+   * @param  value: receives the parsed integer, unchanged on failure
+   * @return bool: true if every character is consumed and the value is in range
+   */
+  template <class T> bool to_integer(T &value) const noexcept {
+    T parsed{};
+    if (::estd::from_chars(data_, data_ + size_, parsed) != data_ + size_ || size_ == 0U) {
+      return false;
+    }
+    value = parsed;
+    return true;
+  }
+
+private:
+  static constexpr size_type length_of(const_pointer str) noexcept {
+    if (!::estd::is_constant_evaluated()) {
+      return __builtin_strlen(str);
+    }
+    size_type length = 0U;
+    while (str[length] != '\0') {
+      ++length;
+    }
+    return length;
+  }
+  static constexpr int compare_n(const_pointer lhs, const_pointer rhs, size_type count) noexcept {
+    if (count == 0U) {
+      return 0;
+    }
+    if (!::estd::is_constant_evaluated()) {
+      return ::estd::memcmp(lhs, rhs, count);
+    }
+    for (size_type i = 0U; i < count; ++i) {
+      if (lhs[i] != rhs[i]) {
+        return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]) ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  const_pointer data_;
+  size_type size_;
+};
+
+constexpr bool operator==(StringView lhs, StringView rhs) noexcept {
+  return lhs.size() == rhs.size() && lhs.compare(rhs) == 0;
+}
+constexpr bool operator!=(StringView lhs, StringView rhs) noexcept { return !(lhs == rhs); }
+constexpr bool operator<(StringView lhs, StringView rhs) noexcept { return lhs.compare(rhs) < 0; }
+constexpr bool operator>(StringView lhs, StringView rhs) noexcept { return rhs < lhs; }
+constexpr bool operator<=(StringView lhs, StringView rhs) noexcept { return !(rhs < lhs); }
+constexpr bool operator>=(StringView lhs, StringView rhs) noexcept { return !(lhs < rhs); }
+
+}; // namespace estd
+
+#endif
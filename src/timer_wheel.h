@@ -0,0 +1,242 @@
+/**
+ * @File Name: timer_wheel.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__timer_wheel__
+#define __estd__timer_wheel__
+
+#include "array.h"
+#include "intrusive_list.h"
+#include "intrusive_traits.h"
+#include "type.h"
+
+namespace estd {
+
+template <::estd::size_t Levels, ::estd::size_t SlotsPerLevel> class TimerWheel;
+
+/**
+ * @brief timer which can be armed in TimerWheel. Embed it in or derive from it in the object to be notified. A timer
+ * unlinks itself from wheel when destroyed.
+ */
+class Timer {
+public:
+  using tick_type = unsigned long long;
+
+  Timer() noexcept : node_{}, bucket_{nullptr}, expiry_{0U} {}
+  Timer(Timer const &) = delete;
+  Timer &operator=(Timer const &) = delete;
+  ~Timer() { unlink(); }
+
+  /**
+   * @brief checks whether timer is armed in a wheel
+   */
+  bool armed() const noexcept { return bucket_ != nullptr; }
+  /**
+   * @brief returns the tick when timer expires
+   */
+  tick_type expiry() const noexcept { return expiry_; }
+
+private:
+  template <::estd::size_t, ::estd::size_t> friend class TimerWheel;
+
+  // node is the first member of standard layout Timer
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Timer, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return 0U; }
+  };
+  using Node = ::estd::IntrusiveListNode<Timer, NodeTraits>;
+  using List = ::estd::IntrusiveList<Node>;
+
+  void unlink() noexcept {
+    if (bucket_ != nullptr) {
+      bucket_->erase(bucket_->iterator_to(*this));
+      bucket_ = nullptr;
+    }
+  }
+
+  Node node_;
+  List *bucket_;
+  tick_type expiry_;
+};
+
+/**
+ * @brief hierarchical timer wheel. Level L has SlotsPerLevel slots, each covering SlotsPerLevel^L ticks. Timers are
+ * kept in IntrusiveList buckets and cascade to lower levels as time advances, arm and cancel are O(1) and tick is
+ * amortized O(1). Timers further than SlotsPerLevel^Levels ticks are parked in the last slot and re-armed by cascade.
+ * @tparam Levels number of levels
+ * @tparam SlotsPerLevel number of slots per level, must be power of two
+ */
+template <::estd::size_t Levels, ::estd::size_t SlotsPerLevel> class TimerWheel {
+  static_assert(Levels >= 1U, "TimerWheel needs at least one level");
+  static_assert(SlotsPerLevel >= 2U && (SlotsPerLevel & (SlotsPerLevel - 1U)) == 0U,
+                "slots per level of TimerWheel must be power of two");
+
+public:
+  using size_type = ::estd::size_t;
+  using tick_type = Timer::tick_type;
+
+  explicit TimerWheel(tick_type now = 0U) noexcept : now_{now}, levels_{} {}
+  TimerWheel(TimerWheel const &) = delete;
+  TimerWheel &operator=(TimerWheel const &) = delete;
+  ~TimerWheel() {
+    for (size_type level = 0U; level < Levels; ++level) {
+      for (size_type slot = 0U; slot < SlotsPerLevel; ++slot) {
+        List &bucket = levels_[level][slot];
+        while (!bucket.empty()) {
+          Timer &timer = *bucket.begin();
+          bucket.pop_front();
+          timer.bucket_ = nullptr;
+        }
+      }
+    }
+  }
+
+  /**
+   * @brief returns the current tick
+   */
+  tick_type now() const noexcept { return now_; }
+  /**
+   * @brief returns the number of armed timers in O(Levels * SlotsPerLevel)
+   */
+  size_type size() const noexcept {
+    size_type count = 0U;
+    for (size_type level = 0U; level < Levels; ++level) {
+      for (size_type slot = 0U; slot < SlotsPerLevel; ++slot) {
+        count += levels_[level][slot].size();
+      }
+    }
+    return count;
+  }
+  bool empty() const noexcept { return size() == 0U; }
+
+  /**
+   * @brief arms timer to expire at tick expiry in O(1), an armed timer is re-armed. Expiry not after now expires in
+   * next tick.
+   * @param  timer: timer to arm
+   * @param  expiry: absolute tick to expire
+   */
+  void arm(Timer &timer, tick_type expiry) noexcept {
+    cancel(timer);
+    timer.expiry_ = expiry > now_ ? expiry : now_ + 1U;
+    place(timer);
+  }
+  /**
+   * @brief arms timer to expire after delay ticks in O(1)
+   * @param  timer: timer to arm
+   * @param  delay: ticks from now
+   */
+  void arm_after(Timer &timer, tick_type delay) noexcept { arm(timer, now_ + delay); }
+  /**
+   * @brief cancels timer in O(1), do nothing if timer is not armed
+   * @param  timer: timer to cancel
+   */
+  void cancel(Timer &timer) noexcept { timer.unlink(); }
+
+  /**
+   * @brief advances one tick and calls on_expire(Timer &) for every expired timer. Expired timers are disarmed before
+   * callback, callback may arm or cancel timers.
+   * @param  on_expire: callback of expired timer
+   */
+  template <class Callback> void tick(Callback &&on_expire) {
+    ++now_;
+    for (size_type level = 1U; level < Levels; ++level) {
+      if ((now_ & low_mask(level)) != 0U) {
+        break;
+      }
+      cascade(levels_[level][index(now_, level)]);
+    }
+    List &bucket = levels_[0][index(now_, 0U)];
+    List pending{};
+    while (!bucket.empty()) {
+      Timer &timer = *bucket.begin();
+      if (timer.expiry_ > now_) {
+        // parked timer which is out of range of wheel
+        pending.splice(pending.end(), bucket, bucket.begin());
+        timer.bucket_ = &pending;
+        continue;
+      }
+      bucket.pop_front();
+      timer.bucket_ = nullptr;
+      on_expire(timer);
+    }
+    cascade(pending);
+  }
+  /**
+   * @brief advances until tick target and calls on_expire(Timer &) for every expired timer
+   * @param  target: absolute tick to advance to
+   * @param  on_expire: callback of expired timer
+   */
+  template <class Callback> void advance(tick_type target, Callback &&on_expire) {
+    while (now_ < target) {
+      tick(on_expire);
+    }
+  }
+
+private:
+  using List = Timer::List;
+
+  static constexpr size_type slot_bits() noexcept {
+    size_type bits = 0U;
+    while ((static_cast<size_type>(1U) << bits) < SlotsPerLevel) {
+      ++bits;
+    }
+    return bits;
+  }
+  static constexpr size_type kSlotBits = slot_bits();
+  static constexpr tick_type kSlotMask = SlotsPerLevel - 1U;
+  static constexpr size_type kTotalBits = kSlotBits * Levels;
+
+  static_assert(kTotalBits <= sizeof(tick_type) * 8U, "TimerWheel covers more ticks than tick_type");
+
+  static constexpr tick_type max_delta() noexcept {
+    return kTotalBits == sizeof(tick_type) * 8U
+               ? ~static_cast<tick_type>(0U)
+               : (static_cast<tick_type>(1U) << (kTotalBits % (sizeof(tick_type) * 8U))) - 1U;
+  }
+  static constexpr tick_type kMaxDelta = max_delta();
+
+  static constexpr tick_type low_mask(size_type level) noexcept {
+    return (static_cast<tick_type>(1U) << (kSlotBits * level)) - 1U;
+  }
+  static constexpr size_type index(tick_type tick, size_type level) noexcept {
+    return static_cast<size_type>((tick >> (kSlotBits * level)) & kSlotMask);
+  }
+
+  // put timer into bucket by its distance from now, expiry must not be before now
+  void place(Timer &timer) noexcept {
+    tick_type const delta = timer.expiry_ - now_;
+    tick_type slot_tick = timer.expiry_;
+    size_type level = 0U;
+    if (delta > kMaxDelta) {
+      // out of range, park in the slot which is cascaded last
+      slot_tick = now_ + kMaxDelta;
+      level = Levels - 1U;
+    } else {
+      while (level + 1U < Levels && (delta >> (kSlotBits * (level + 1U))) != 0U) {
+        ++level;
+      }
+    }
+    List &bucket = levels_[level][index(slot_tick, level)];
+    bucket.push_back(timer);
+    timer.bucket_ = &bucket;
+  }
+
+  void cascade(List &bucket) noexcept {
+    List pending{};
+    pending.splice(pending.end(), bucket);
+    while (!pending.empty()) {
+      Timer &timer = *pending.begin();
+      pending.pop_front();
+      place(timer);
+    }
+  }
+
+  tick_type now_;
+  ::estd::Array<::estd::Array<List, SlotsPerLevel>, Levels> levels_;
+};
+
+}; // namespace estd
+
+#endif
@@ -25,6 +25,22 @@ using size_t = decltype(sizeof(int));
  */
 using ptrdiff_t = decltype(static_cast<char *>(nullptr) - static_cast<char *>(nullptr));
 
+/**
+ * @brief std::uint32_t is an unsigned integer type with width of exactly 32 bits.
+ */
+using uint32_t = __UINT32_TYPE__;
+
+/**
+ * @brief std::uintptr_t is an unsigned integer type capable of holding a pointer to void.
+ */
+using uintptr_t = __UINTPTR_TYPE__;
+
+/**
+ * @brief std::max_align_t is a trivial standard-layout type whose alignment requirement is at least as strict as that
+of every scalar type.
+ */
+struct alignas(alignof(long double) > alignof(long long) ? alignof(long double) : alignof(long long)) max_align_t {};
+
 }; // namespace estd
 
 #endif
\ No newline at end of file
@@ -51,9 +51,143 @@ template <class T> struct is_lvalue_reference<T &> : ::estd::true_type {};
 template <class T> struct is_const : ::estd::false_type {};
 template <class T> struct is_const<T const> : ::estd::true_type {};
 
+namespace detail {
+
+template <class T> struct is_integral_impl : ::estd::false_type {};
+template <> struct is_integral_impl<bool> : ::estd::true_type {};
+template <> struct is_integral_impl<char> : ::estd::true_type {};
+template <> struct is_integral_impl<signed char> : ::estd::true_type {};
+template <> struct is_integral_impl<unsigned char> : ::estd::true_type {};
+template <> struct is_integral_impl<wchar_t> : ::estd::true_type {};
+template <> struct is_integral_impl<char16_t> : ::estd::true_type {};
+template <> struct is_integral_impl<char32_t> : ::estd::true_type {};
+template <> struct is_integral_impl<short> : ::estd::true_type {};
+template <> struct is_integral_impl<unsigned short> : ::estd::true_type {};
+template <> struct is_integral_impl<int> : ::estd::true_type {};
+template <> struct is_integral_impl<unsigned int> : ::estd::true_type {};
+template <> struct is_integral_impl<long> : ::estd::true_type {};
+template <> struct is_integral_impl<unsigned long> : ::estd::true_type {};
+template <> struct is_integral_impl<long long> : ::estd::true_type {};
+template <> struct is_integral_impl<unsigned long long> : ::estd::true_type {};
+
+}; // namespace detail
+
+template <class T> struct is_integral : ::estd::detail::is_integral_impl<typename ::estd::remove_cv<T>::type> {};
+
+namespace detail {
+
+template <class T> struct is_floating_point_impl : ::estd::false_type {};
+template <> struct is_floating_point_impl<float> : ::estd::true_type {};
+template <> struct is_floating_point_impl<double> : ::estd::true_type {};
+template <> struct is_floating_point_impl<long double> : ::estd::true_type {};
+
+}; // namespace detail
+
+template <class T>
+struct is_floating_point : ::estd::detail::is_floating_point_impl<typename ::estd::remove_cv<T>::type> {};
+
+template <class T>
+struct is_arithmetic
+    : ::estd::integral_constant<bool, ::estd::is_integral<T>::value || ::estd::is_floating_point<T>::value> {};
+
+namespace detail {
+
+template <class T, bool = ::estd::is_arithmetic<T>::value>
+struct is_signed_impl : ::estd::integral_constant<bool, T(-1) < T(0)> {};
+template <class T> struct is_signed_impl<T, false> : ::estd::false_type {};
+
+}; // namespace detail
+
+template <class T> struct is_signed : ::estd::detail::is_signed_impl<typename ::estd::remove_cv<T>::type> {};
+
+namespace detail {
+
+template <class T> struct make_unsigned_impl {};
+template <> struct make_unsigned_impl<char> { using type = unsigned char; };
+template <> struct make_unsigned_impl<signed char> { using type = unsigned char; };
+template <> struct make_unsigned_impl<unsigned char> { using type = unsigned char; };
+template <> struct make_unsigned_impl<short> { using type = unsigned short; };
+template <> struct make_unsigned_impl<unsigned short> { using type = unsigned short; };
+template <> struct make_unsigned_impl<int> { using type = unsigned int; };
+template <> struct make_unsigned_impl<unsigned int> { using type = unsigned int; };
+template <> struct make_unsigned_impl<long> { using type = unsigned long; };
+template <> struct make_unsigned_impl<unsigned long> { using type = unsigned long; };
+template <> struct make_unsigned_impl<long long> { using type = unsigned long long; };
+template <> struct make_unsigned_impl<unsigned long long> { using type = unsigned long long; };
+
+}; // namespace detail
+
+template <class T> struct make_unsigned : ::estd::detail::make_unsigned_impl<typename ::estd::remove_cv<T>::type> {};
+
+namespace detail {
+
+template <class T> struct is_pointer_impl : ::estd::false_type {};
+template <class T> struct is_pointer_impl<T *> : ::estd::true_type {};
+
+}; // namespace detail
+
+template <class T> struct is_pointer : ::estd::detail::is_pointer_impl<typename ::estd::remove_cv<T>::type> {};
+
 template <bool B, class T, class F> struct conditional { using type = T; };
 template <class T, class F> struct conditional<false, T, F> { using type = F; };
 
+template <bool B, class T = void> struct enable_if {};
+template <class T> struct enable_if<true, T> { using type = T; };
+
+template <class... T> struct make_void { using type = void; };
+/**
+ * @brief maps any well formed types to void, used to detect expressions by SFINAE
+ */
+template <class... T> using void_t = typename ::estd::make_void<T...>::type;
+
+template <class T, class... Args>
+struct is_constructible : ::estd::integral_constant<bool, __is_constructible(T, Args...)> {};
+template <class T, class... Args>
+struct is_nothrow_constructible : ::estd::integral_constant<bool, __is_nothrow_constructible(T, Args...)> {};
+template <class T> struct is_copy_constructible : ::estd::is_constructible<T, T const &> {};
+template <class T> struct is_move_constructible : ::estd::is_constructible<T, T &&> {};
+template <class T> struct is_nothrow_move_constructible : ::estd::is_nothrow_constructible<T, T &&> {};
+
+template <class T> struct is_trivially_copyable : ::estd::integral_constant<bool, __is_trivially_copyable(T)> {};
+
+#if defined(__clang__)
+template <class T>
+struct is_trivially_destructible : ::estd::integral_constant<bool, __is_trivially_destructible(T)> {};
+#else
+template <class T> struct is_trivially_destructible : ::estd::integral_constant<bool, __has_trivial_destructor(T)> {};
+#endif
+
+/**
+ * @brief 1 if the compiler provides __builtin_is_constant_evaluated (GCC 9, Clang 9 and later), override it for the
+ * target when __has_builtin is missing
+ */
+#ifndef ESTD_HAS_CONSTANT_EVALUATED
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define ESTD_HAS_CONSTANT_EVALUATED 1
+#endif
+#endif
+#endif
+#ifndef ESTD_HAS_CONSTANT_EVALUATED
+#define ESTD_HAS_CONSTANT_EVALUATED 0
+#endif
+
+/**
+ * @brief detects whether the call occurs within a constant-evaluated context, so that a constexpr function can avoid
+ * builtins which are not usable in constant expressions. Without ESTD_HAS_CONSTANT_EVALUATED it always returns false:
+ * runtime calls keep the memset and memcmp fast paths, and constant evaluation of those paths, such as filling or
+ * comparing an Array of bytes, fails to compile instead of silently slowing down every runtime call.
+ * @return true: constant evaluated
+ * @return false: evaluated at runtime or the compiler cannot tell
+ */
+constexpr bool is_constant_evaluated() noexcept {
+#if ESTD_HAS_CONSTANT_EVALUATED
+  return __builtin_is_constant_evaluated();
+#else
+  return false;
+#endif
+}
+
 }; // namespace estd
 
 #endif
@@ -8,18 +8,104 @@
 #ifndef __estd_utility__
 #define __estd_utility__
 
+#include "type.h"
 #include "type_traits.h"
 
 namespace estd {
 
-template <class T> T &&forward(typename ::estd::remove_reference<T>::type &t) noexcept {
+template <class T> constexpr T &&forward(typename ::estd::remove_reference<T>::type &t) noexcept {
   return (static_cast<T &&>(t));
 }
-template <class T> T &&forward(typename ::estd::remove_reference<T>::type &&t) noexcept {
+template <class T> constexpr T &&forward(typename ::estd::remove_reference<T>::type &&t) noexcept {
   static_assert(!::estd::is_lvalue_reference<T>::value, "cannot forward an rvalue as an lvalue");
   return (static_cast<T &&>(t));
 }
 
+template <class T> constexpr typename ::estd::remove_reference<T>::type &&move(T &&t) noexcept {
+  return static_cast<typename ::estd::remove_reference<T>::type &&>(t);
+}
+
+/**
+ * @brief obtains an rvalue reference if the move constructor of T does not throw or T is not copyable, otherwise an
+ * lvalue reference, so that a copy keeps the source intact if copying throws
+ */
+template <class T>
+constexpr typename ::estd::conditional<!::estd::is_nothrow_move_constructible<T>::value &&
+                                           ::estd::is_copy_constructible<T>::value,
+                                       T const &, T &&>::type
+move_if_noexcept(T &t) noexcept {
+  return ::estd::move(t);
+}
+
+/**
+ * @brief replaces the value of obj with new_value and returns the old value of obj
+ * @param  obj: object whose value to replace
+ * @param  new_value: value to assign to obj
+ * @return T: old value of obj
+ */
+template <class T, class U = T> constexpr T exchange(T &obj, U &&new_value) {
+  T old = ::estd::move(obj);
+  obj = ::estd::forward<U>(new_value);
+  return old;
+}
+
+/**
+ * @brief converts any type T to a reference type, only usable in unevaluated contexts such as decltype
+ */
+template <class T> T &&declval() noexcept;
+
+/**
+ * @brief compile time sequence of integers, used to expand packs by index
+ */
+template <class T, T... Ints> struct integer_sequence {
+  using value_type = T;
+  static constexpr ::estd::size_t size() noexcept { return sizeof...(Ints); }
+};
+template <::estd::size_t... Ints> using index_sequence = ::estd::integer_sequence<::estd::size_t, Ints...>;
+
+namespace detail {
+
+template <class Lhs, class Rhs> struct concat_index_sequence;
+template <::estd::size_t... Lhs, ::estd::size_t... Rhs>
+struct concat_index_sequence<::estd::index_sequence<Lhs...>, ::estd::index_sequence<Rhs...>> {
+  using type = ::estd::index_sequence<Lhs..., (sizeof...(Lhs) + Rhs)...>;
+};
+// halves N so that the instantiation depth is log2(N)
+template <::estd::size_t N> struct make_index_sequence {
+  using type = typename ::estd::detail::concat_index_sequence<
+      typename ::estd::detail::make_index_sequence<N / 2U>::type,
+      typename ::estd::detail::make_index_sequence<N - N / 2U>::type>::type;
+};
+template <> struct make_index_sequence<0U> {
+  using type = ::estd::index_sequence<>;
+};
+template <> struct make_index_sequence<1U> {
+  using type = ::estd::index_sequence<0U>;
+};
+
+}; // namespace detail
+
+template <::estd::size_t N> using make_index_sequence = typename ::estd::detail::make_index_sequence<N>::type;
+template <class... T> using index_sequence_for = ::estd::make_index_sequence<sizeof...(T)>;
+
+/**
+ * @brief tags to select the constructor which constructs the contained objects in place
+ */
+struct in_place_t {
+  explicit in_place_t() = default;
+};
+constexpr ::estd::in_place_t in_place{};
+
+template <class T> struct in_place_type_t {
+  explicit in_place_type_t() = default;
+};
+template <class T> constexpr ::estd::in_place_type_t<T> in_place_type{};
+
+template <::estd::size_t I> struct in_place_index_t {
+  explicit in_place_index_t() = default;
+};
+template <::estd::size_t I> constexpr ::estd::in_place_index_t<I> in_place_index{};
+
 }; // namespace estd
 
 #endif
@@ -0,0 +1,121 @@
+#include "algorithm.h"
+#include "benchmark.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kSize = 100000U;
+constexpr std::size_t kLookup = 1000000U;
+
+enum class Input { kRandom, kSorted, kReversed };
+
+char const *input_name(Input input) noexcept {
+  switch (input) {
+  case Input::kRandom:
+    return "random";
+  case Input::kSorted:
+    return "sorted";
+  case Input::kReversed:
+    return "reversed";
+  }
+  return "";
+}
+
+std::vector<std::uint32_t> make_input(Input input) {
+  std::vector<std::uint32_t> values(kSize);
+  std::mt19937 random{42U};
+  for (std::size_t i = 0U; i < kSize; ++i) {
+    values[i] = input == Input::kRandom ? static_cast<std::uint32_t>(random()) : static_cast<std::uint32_t>(i);
+  }
+  if (input == Input::kReversed) {
+    std::reverse(values.begin(), values.end());
+  }
+  return values;
+}
+
+// every run works on a fresh copy of input, the copy is measured for both sides
+template <class Fn> void run_pair(char const *what, Input input, std::vector<std::uint32_t> const &values, Fn &&fn) {
+  std::vector<std::uint32_t> work(values.size());
+  char name[96];
+  std::snprintf(name, sizeof(name), "std::%s %s", what, input_name(input));
+  bench::run(name, kSize, [&]() {
+    work = values;
+    fn(work.data(), work.data() + work.size(), true);
+    bench::do_not_optimize(work);
+  });
+  std::snprintf(name, sizeof(name), "estd::%s %s", what, input_name(input));
+  bench::run(name, kSize, [&]() {
+    work = values;
+    fn(work.data(), work.data() + work.size(), false);
+    bench::do_not_optimize(work);
+  });
+}
+
+void run_input(Input input) {
+  std::vector<std::uint32_t> const values = make_input(input);
+
+  run_pair("sort", input, values, [](std::uint32_t *first, std::uint32_t *last, bool use_std) {
+    use_std ? std::sort(first, last) : ::estd::sort(first, last);
+  });
+  run_pair("nth_element", input, values, [](std::uint32_t *first, std::uint32_t *last, bool use_std) {
+    std::uint32_t *const nth = first + (last - first) / 2;
+    use_std ? std::nth_element(first, nth, last) : ::estd::nth_element(first, nth, last);
+  });
+  run_pair("partition", input, values, [](std::uint32_t *first, std::uint32_t *last, bool use_std) {
+    auto const pred = [](std::uint32_t value) { return (value & 1U) == 0U; };
+    bench::do_not_optimize(use_std ? std::partition(first, last, pred) : ::estd::partition(first, last, pred));
+  });
+  run_pair("min_element", input, values, [](std::uint32_t *first, std::uint32_t *last, bool use_std) {
+    bench::do_not_optimize(use_std ? std::min_element(first, last) : ::estd::min_element(first, last));
+  });
+  run_pair("rotate", input, values, [](std::uint32_t *first, std::uint32_t *last, bool use_std) {
+    std::uint32_t *const middle = first + (last - first) / 3;
+    bench::do_not_optimize(use_std ? std::rotate(first, middle, last) : ::estd::rotate(first, middle, last));
+  });
+}
+
+void run_search() {
+  std::vector<std::uint32_t> values = make_input(Input::kRandom);
+  std::sort(values.begin(), values.end());
+  std::vector<std::uint32_t> keys(kLookup);
+  std::mt19937 random{7U};
+  for (std::uint32_t &key : keys) {
+    key = static_cast<std::uint32_t>(random());
+  }
+  std::uint32_t const *const first = values.data();
+  std::uint32_t const *const last = values.data() + values.size();
+  bench::run("std::lower_bound", kLookup, [&]() {
+    for (std::uint32_t key : keys) {
+      bench::do_not_optimize(std::lower_bound(first, last, key));
+    }
+  });
+  bench::run("estd::lower_bound", kLookup, [&]() {
+    for (std::uint32_t key : keys) {
+      bench::do_not_optimize(::estd::lower_bound(first, last, key));
+    }
+  });
+  bench::run("std::upper_bound", kLookup, [&]() {
+    for (std::uint32_t key : keys) {
+      bench::do_not_optimize(std::upper_bound(first, last, key));
+    }
+  });
+  bench::run("estd::upper_bound", kLookup, [&]() {
+    for (std::uint32_t key : keys) {
+      bench::do_not_optimize(::estd::upper_bound(first, last, key));
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_input(Input::kRandom);
+  run_input(Input::kSorted);
+  run_input(Input::kReversed);
+  run_search();
+  return 0;
+}
@@ -0,0 +1,203 @@
+#include "algorithm.h"
+#include "array.h"
+#include <algorithm>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<int> make_random(std::size_t size, int range, std::uint32_t seed) {
+  std::mt19937 random{seed};
+  std::vector<int> values(size);
+  for (int &value : values) {
+    value = static_cast<int>(random() % static_cast<std::uint32_t>(range));
+  }
+  return values;
+}
+
+} // namespace
+
+TEST(Algorithm, sort_random) {
+  for (std::size_t size : {0U, 1U, 2U, 15U, 16U, 17U, 100U, 1000U, 10000U}) {
+    std::vector<int> values = make_random(size, 1000000, static_cast<std::uint32_t>(size));
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    ::estd::sort(values.data(), values.data() + values.size());
+    EXPECT_EQ(values, expected);
+  }
+}
+
+TEST(Algorithm, sort_duplicates) {
+  std::vector<int> values = make_random(10000U, 3, 1U);
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+  ::estd::sort(values.data(), values.data() + values.size());
+  EXPECT_EQ(values, expected);
+}
+
+TEST(Algorithm, sort_sorted_and_reversed) {
+  std::vector<int> values(5000U);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<int>(i);
+  }
+  std::vector<int> const expected = values;
+  ::estd::sort(values.data(), values.data() + values.size());
+  EXPECT_EQ(values, expected);
+  std::reverse(values.begin(), values.end());
+  ::estd::sort(values.data(), values.data() + values.size());
+  EXPECT_EQ(values, expected);
+}
+
+TEST(Algorithm, sort_organ_pipe) {
+  // organ pipe input is a bad case of median of three pivot
+  std::vector<int> values(10000U);
+  for (std::size_t i = 0; i < values.size() / 2U; ++i) {
+    values[i] = static_cast<int>(i);
+    values[values.size() - 1U - i] = static_cast<int>(i);
+  }
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end());
+  ::estd::sort(values.data(), values.data() + values.size());
+  EXPECT_EQ(values, expected);
+}
+
+TEST(Algorithm, sort_comp) {
+  std::vector<int> values = make_random(1000U, 100, 2U);
+  std::vector<int> expected = values;
+  std::sort(expected.begin(), expected.end(), std::greater<int>{});
+  ::estd::sort(values.data(), values.data() + values.size(), std::greater<int>{});
+  EXPECT_EQ(values, expected);
+}
+
+TEST(Algorithm, sort_array) {
+  ::estd::Array<int, 5> array{5, 3, 1, 4, 2};
+  ::estd::sort(array.begin(), array.end());
+  EXPECT_EQ(array, (::estd::to_array<int>(1, 2, 3, 4, 5)));
+}
+
+TEST(Algorithm, sort_non_trivial) {
+  std::vector<std::string> values{};
+  for (int value : make_random(200U, 50, 3U)) {
+    values.push_back(std::to_string(value));
+  }
+  std::vector<std::string> expected = values;
+  std::sort(expected.begin(), expected.end());
+  ::estd::sort(values.data(), values.data() + values.size());
+  EXPECT_EQ(values, expected);
+}
+
+TEST(Algorithm, nth_element) {
+  for (std::size_t size : {1U, 10U, 100U, 10000U}) {
+    std::vector<int> values = make_random(size, 1000, static_cast<std::uint32_t>(size));
+    std::vector<int> sorted = values;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t nth : {std::size_t{0U}, size / 3U, size - 1U}) {
+      std::vector<int> copy = values;
+      ::estd::nth_element(copy.data(), copy.data() + nth, copy.data() + copy.size());
+      EXPECT_EQ(copy[nth], sorted[nth]);
+      for (std::size_t i = 0; i < nth; ++i) {
+        EXPECT_LE(copy[i], copy[nth]);
+      }
+      for (std::size_t i = nth + 1U; i < size; ++i) {
+        EXPECT_GE(copy[i], copy[nth]);
+      }
+    }
+  }
+}
+
+TEST(Algorithm, partition) {
+  std::vector<int> values = make_random(1000U, 100, 4U);
+  auto const is_even = [](int value) { return value % 2 == 0; };
+  std::size_t const even = static_cast<std::size_t>(std::count_if(values.begin(), values.end(), is_even));
+  int *const point = ::estd::partition(values.data(), values.data() + values.size(), is_even);
+  EXPECT_EQ(static_cast<std::size_t>(point - values.data()), even);
+  EXPECT_TRUE(std::is_partitioned(values.begin(), values.end(), is_even));
+
+  ::estd::Array<int, 4> array{1, 3, 5, 7};
+  EXPECT_EQ(::estd::partition(array.begin(), array.end(), is_even), array.begin());
+  EXPECT_EQ(::estd::partition(array.begin(), array.begin(), is_even), array.begin());
+}
+
+TEST(Algorithm, lower_bound_upper_bound) {
+  std::vector<int> values = make_random(1000U, 200, 5U);
+  std::sort(values.begin(), values.end());
+  int const *const first = values.data();
+  int const *const last = values.data() + values.size();
+  for (int value = -1; value <= 201; ++value) {
+    EXPECT_EQ(::estd::lower_bound(first, last, value) - first,
+              std::lower_bound(values.begin(), values.end(), value) - values.begin())
+        << value;
+    EXPECT_EQ(::estd::upper_bound(first, last, value) - first,
+              std::upper_bound(values.begin(), values.end(), value) - values.begin())
+        << value;
+  }
+}
+
+TEST(Algorithm, lower_bound_small) {
+  ::estd::Array<int, 4> const array{1, 2, 2, 4};
+  EXPECT_EQ(::estd::lower_bound(array.begin(), array.begin(), 1), array.begin());
+  EXPECT_EQ(::estd::lower_bound(array.begin(), array.begin() + 1, 0), array.begin());
+  EXPECT_EQ(::estd::lower_bound(array.begin(), array.begin() + 1, 2), array.begin() + 1);
+  EXPECT_EQ(::estd::lower_bound(array.begin(), array.end(), 2), array.begin() + 1);
+  EXPECT_EQ(::estd::upper_bound(array.begin(), array.end(), 2), array.begin() + 3);
+  EXPECT_EQ(::estd::lower_bound(array.begin(), array.end(), 5), array.end());
+  EXPECT_EQ(::estd::upper_bound(array.begin(), array.end(), 4), array.end());
+  EXPECT_EQ(::estd::upper_bound(array.begin(), array.end(), 0), array.begin());
+}
+
+TEST(Algorithm, min_element) {
+  ::estd::Array<int, 5> const array{3, 1, 4, 1, 5};
+  EXPECT_EQ(::estd::min_element(array.begin(), array.end()), array.begin() + 1);
+  EXPECT_EQ(::estd::min_element(array.begin(), array.end(), std::greater<int>{}), array.begin() + 4);
+  EXPECT_EQ(::estd::min_element(array.begin(), array.begin()), array.begin());
+}
+
+TEST(Algorithm, rotate) {
+  for (std::size_t middle = 0; middle <= 7U; ++middle) {
+    ::estd::Array<int, 7> array{0, 1, 2, 3, 4, 5, 6};
+    std::vector<int> expected(array.begin(), array.end());
+    std::rotate(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(middle), expected.end());
+    int *const result = ::estd::rotate(array.begin(), array.begin() + middle, array.end());
+    EXPECT_EQ(result, array.begin() + (7U - middle));
+    EXPECT_EQ(std::vector<int>(array.begin(), array.end()), expected);
+  }
+}
+
+TEST(Algorithm, rotate_large) {
+  for (std::size_t middle : {1U, 33U, 50U, 67U, 99U}) {
+    std::vector<std::string> values{};
+    for (int i = 0; i < 100; ++i) {
+      values.push_back(std::to_string(i));
+    }
+    std::vector<std::string> expected = values;
+    std::rotate(expected.begin(), expected.begin() + static_cast<std::ptrdiff_t>(middle), expected.end());
+    ::estd::rotate(values.data(), values.data() + middle, values.data() + values.size());
+    EXPECT_EQ(values, expected);
+  }
+}
+
+namespace {
+
+constexpr ::estd::Array<int, 40U> make_sorted() {
+  ::estd::Array<int, 40U> a{};
+  for (int i = 0; i < 40; ++i) {
+    a[static_cast<::estd::size_t>(i)] = (i * 17) % 40;
+  }
+  ::estd::sort(a.begin(), a.end());
+  return a;
+}
+
+constexpr ::estd::Array<int, 40U> kSorted = make_sorted();
+
+} // namespace
+
+TEST(Algorithm, constexpr_sort_and_search) {
+  static_assert(kSorted.front() == 0 && kSorted.back() == 39, "");
+  static_assert(*::estd::lower_bound(kSorted.begin(), kSorted.end(), 21) == 21, "");
+  static_assert(::estd::upper_bound(kSorted.begin(), kSorted.end(), 39) == kSorted.end(), "");
+  static_assert(*::estd::min_element(kSorted.begin(), kSorted.end()) == 0, "");
+  EXPECT_TRUE(std::is_sorted(kSorted.begin(), kSorted.end()));
+}
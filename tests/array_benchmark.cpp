@@ -0,0 +1,97 @@
+#include "array.h"
+#include "benchmark.h"
+#include <cstdint>
+#include <cstdio>
+
+namespace {
+
+constexpr std::size_t kRound = 100000U;
+
+template <class T, std::size_t N> void naive_fill(::estd::Array<T, N> &array, T const &value) noexcept {
+  for (std::size_t i = 0U; i < N; ++i) {
+    array[i] = value;
+  }
+}
+
+template <class T, std::size_t N>
+bool naive_equal(::estd::Array<T, N> const &lhs, ::estd::Array<T, N> const &rhs) noexcept {
+  for (std::size_t i = 0U; i < N; ++i) {
+    if (lhs[i] != rhs[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <class T, std::size_t N> void naive_swap(::estd::Array<T, N> &lhs, ::estd::Array<T, N> &rhs) noexcept {
+  for (std::size_t i = 0U; i < N; ++i) {
+    T const temp = lhs[i];
+    lhs[i] = rhs[i];
+    rhs[i] = temp;
+  }
+}
+
+template <class T, std::size_t N> void run_all(char const *type_name, T const &a, T const &b) {
+  static ::estd::Array<T, N> lhs{};
+  static ::estd::Array<T, N> rhs{};
+  char name[128];
+
+  std::snprintf(name, sizeof(name), "naive fill %s", type_name);
+  bench::run(name, kRound, [&a]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      naive_fill(lhs, a);
+      bench::do_not_optimize(lhs);
+    }
+  });
+  std::snprintf(name, sizeof(name), "Array::fill %s", type_name);
+  bench::run(name, kRound, [&a]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      lhs.fill(a);
+      bench::do_not_optimize(lhs);
+    }
+  });
+
+  rhs.fill(a);
+  std::snprintf(name, sizeof(name), "naive == %s", type_name);
+  bench::run(name, kRound, []() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      bench::do_not_optimize(naive_equal(lhs, rhs));
+    }
+  });
+  std::snprintf(name, sizeof(name), "Array == %s", type_name);
+  bench::run(name, kRound, []() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      bench::do_not_optimize(lhs == rhs);
+    }
+  });
+
+  rhs.fill(b);
+  std::snprintf(name, sizeof(name), "naive swap %s", type_name);
+  bench::run(name, kRound, []() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      naive_swap(lhs, rhs);
+      bench::do_not_optimize(rhs);
+    }
+  });
+  std::snprintf(name, sizeof(name), "Array::swap %s", type_name);
+  bench::run(name, kRound, []() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      bench::do_not_optimize(lhs);
+      lhs.swap(rhs);
+      bench::do_not_optimize(rhs);
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_all<std::uint8_t, 4096U>("Array<uint8_t, 4096>", 0x5AU, 0xA5U);
+  run_all<float, 1024U>("Array<float, 1024>", 1.5F, 2.5F);
+  return 0;
+}
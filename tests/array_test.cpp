@@ -1,5 +1,10 @@
 #include "array.h"
+#include <algorithm>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <type_traits>
 
 struct ST {
   int a;
@@ -7,6 +12,36 @@ struct ST {
   int c;
 };
 
+// counts special member calls to check that elements are not copied through temporaries
+struct BigPayload {
+  static int constructions;
+  static int copies;
+  static int moves;
+  static void reset() {
+    constructions = 0;
+    copies = 0;
+    moves = 0;
+  }
+
+  BigPayload() noexcept : bytes{} { ++constructions; }
+  explicit BigPayload(unsigned char value) noexcept : bytes{value} { ++constructions; }
+  BigPayload(BigPayload const &other) noexcept : bytes{} {
+    ++copies;
+    std::copy(std::begin(other.bytes), std::end(other.bytes), std::begin(bytes));
+  }
+  BigPayload(BigPayload &&other) noexcept : bytes{} {
+    ++moves;
+    std::copy(std::begin(other.bytes), std::end(other.bytes), std::begin(bytes));
+  }
+  BigPayload &operator=(BigPayload const &) = default;
+  BigPayload &operator=(BigPayload &&) = default;
+
+  unsigned char bytes[256];
+};
+int BigPayload::constructions = 0;
+int BigPayload::copies = 0;
+int BigPayload::moves = 0;
+
 TEST(Array, fill) {
   const int VALUE = 11;
   ::estd::Array<int, 10> array{};
@@ -64,7 +99,222 @@ TEST(Array, swap) {
   EXPECT_EQ(arr2, arr1_copy);
 }
 
+TEST(Array, swap_member) {
+  auto arr1 = ::estd::to_array<int>(1, 2, 3);
+  auto arr2 = ::estd::to_array<int>(4, 5, 6);
+  arr1.swap(arr2);
+  EXPECT_EQ(arr1, (::estd::to_array<int>(4, 5, 6)));
+  EXPECT_EQ(arr2, (::estd::to_array<int>(1, 2, 3)));
+}
+
+TEST(Array, swap_large) {
+  ::estd::Array<unsigned char, 1000> arr1{};
+  ::estd::Array<unsigned char, 1000> arr2{};
+  for (std::size_t i = 0; i < arr1.size(); ++i) {
+    arr1[i] = static_cast<unsigned char>(i);
+    arr2[i] = static_cast<unsigned char>(i * 3U);
+  }
+  ::estd::swap(arr1, arr2);
+  for (std::size_t i = 0; i < arr1.size(); ++i) {
+    EXPECT_EQ(arr1[i], static_cast<unsigned char>(i * 3U));
+    EXPECT_EQ(arr2[i], static_cast<unsigned char>(i));
+  }
+}
+
+TEST(Array, swap_non_trivial) {
+  ::estd::Array<std::string, 2> arr1{std::string{"a"}, std::string{"b"}};
+  ::estd::Array<std::string, 2> arr2{std::string{"c"}, std::string{"d"}};
+  ::estd::swap(arr1, arr2);
+  EXPECT_EQ(arr1[0], "c");
+  EXPECT_EQ(arr1[1], "d");
+  EXPECT_EQ(arr2[0], "a");
+  EXPECT_EQ(arr2[1], "b");
+}
+
+TEST(Array, fill_byte) {
+  ::estd::Array<unsigned char, 33> array{};
+  array.fill(0xA5U);
+  for (auto value : array) {
+    EXPECT_EQ(value, 0xA5U);
+  }
+}
+
+TEST(Array, fill_float) {
+  ::estd::Array<float, 37> array{};
+  array.fill(1.5F);
+  for (auto value : array) {
+    EXPECT_EQ(value, 1.5F);
+  }
+}
+
+TEST(Array, fill_non_trivial) {
+  ::estd::Array<std::string, 3> array{};
+  array.fill("abc");
+  for (auto const &value : array) {
+    EXPECT_EQ(value, "abc");
+  }
+}
+
+TEST(Array, equal) {
+  auto arr1 = ::estd::to_array<int>(1, 2, 3);
+  auto arr2 = ::estd::to_array<int>(1, 2, 4);
+  EXPECT_TRUE(arr1 == arr1);
+  EXPECT_FALSE(arr1 == arr2);
+  EXPECT_TRUE(arr1 != arr2);
+}
+
+TEST(Array, equal_float) {
+  ::estd::Array<float, 2> const zero{0.0F, 1.0F};
+  ::estd::Array<float, 2> const negative_zero{-0.0F, 1.0F};
+  EXPECT_TRUE(zero == negative_zero);
+}
+
+TEST(Array, lexicographical_compare) {
+  auto arr1 = ::estd::to_array<int>(1, 5, 0);
+  auto arr2 = ::estd::to_array<int>(2, 0, 0);
+  EXPECT_TRUE(arr1 < arr2);
+  EXPECT_TRUE(arr1 <= arr2);
+  EXPECT_FALSE(arr1 > arr2);
+  EXPECT_FALSE(arr1 >= arr2);
+  EXPECT_FALSE(arr1 < arr1);
+  EXPECT_TRUE(arr1 <= arr1);
+  EXPECT_TRUE(arr1 >= arr1);
+}
+
+TEST(Array, lexicographical_compare_byte) {
+  using byte = unsigned char;
+  ::estd::Array<byte, 3> const arr1{byte{1U}, byte{0xFFU}, byte{0U}};
+  ::estd::Array<byte, 3> const arr2{byte{1U}, byte{0xFFU}, byte{1U}};
+  ::estd::Array<byte, 3> const arr3{byte{2U}, byte{0U}, byte{0U}};
+  EXPECT_TRUE(arr1 < arr2);
+  EXPECT_TRUE(arr2 < arr3);
+  EXPECT_FALSE(arr3 < arr1);
+  EXPECT_TRUE(arr3 > arr1);
+}
+
+TEST(Array, lexicographical_compare_signed) {
+  using byte = signed char;
+  ::estd::Array<byte, 2> const arr1{byte{-1}, byte{0}};
+  ::estd::Array<byte, 2> const arr2{byte{1}, byte{0}};
+  EXPECT_TRUE(arr1 < arr2);
+}
+
 TEST(ArrayDeathTest, at_out_of_range) {
   ::estd::Array<int, 5> const array{1, 2, 3};
   ASSERT_DEATH(array.at(5), "");
-}
\ No newline at end of file
+}
+TEST(Array, in_place_constructs_each_element_once) {
+  BigPayload::reset();
+  ::estd::Array<BigPayload, 64> const array{::estd::in_place, static_cast<unsigned char>(7U)};
+  EXPECT_EQ(BigPayload::constructions, 64);
+  EXPECT_EQ(BigPayload::copies, 0);
+  EXPECT_EQ(BigPayload::moves, 0);
+  EXPECT_EQ(array[63].bytes[0], 7U);
+}
+TEST(Array, in_place_requires_constructor) {
+  // a C style cast would accept these through reinterpret_cast
+  static_assert(!std::is_constructible<::estd::Array<int *, 1>, ::estd::in_place_t, long>::value, "");
+  static_assert(!std::is_constructible<::estd::Array<long, 1>, ::estd::in_place_t, int *>::value, "");
+  static_assert(std::is_constructible<::estd::Array<long, 1>, ::estd::in_place_t, int>::value, "");
+  ::estd::Array<int *, 2> const array{::estd::in_place, nullptr};
+  EXPECT_EQ(array[1], nullptr);
+}
+
+TEST(Array, constructor_forwards_values) {
+  BigPayload const lvalue{1U};
+  BigPayload rvalue{2U};
+  BigPayload::reset();
+  ::estd::Array<BigPayload, 3> const array{lvalue, ::estd::move(rvalue)};
+  EXPECT_EQ(BigPayload::copies, 1);
+  EXPECT_EQ(BigPayload::moves, 1);
+  // the remaining element is value initialized
+  EXPECT_EQ(BigPayload::constructions, 1);
+  EXPECT_EQ(array[0].bytes[0], 1U);
+  EXPECT_EQ(array[1].bytes[0], 2U);
+}
+
+TEST(Array, to_array_forwards_values) {
+  BigPayload const lvalue{1U};
+  BigPayload::reset();
+  auto const array = ::estd::to_array(lvalue, BigPayload{2U}, BigPayload{3U});
+  EXPECT_EQ(BigPayload::constructions, 2);
+  EXPECT_EQ(BigPayload::copies, 1);
+  EXPECT_EQ(BigPayload::moves, 2);
+  EXPECT_EQ(array[2].bytes[0], 3U);
+}
+
+TEST(Array, to_array_from_builtin_array) {
+  int const values[] = {1, 2, 3};
+  auto const array = ::estd::to_array(values);
+  EXPECT_EQ(array.size(), 3U);
+  EXPECT_EQ(array[2], 3);
+
+  auto const strings = ::estd::to_array({std::string{"a"}, std::string{"b"}});
+  EXPECT_EQ(strings[1], "b");
+}
+
+TEST(Array, copy_from_non_const_lvalue) {
+  ::estd::Array<int, 3> array{1, 2, 3};
+  ::estd::Array<int, 3> copy{array};
+  EXPECT_EQ(copy, array);
+}
+
+namespace {
+
+constexpr ::estd::Array<std::uint32_t, 256U> make_crc32_table() {
+  ::estd::Array<std::uint32_t, 256U> table{};
+  for (std::uint32_t i = 0U; i < 256U; ++i) {
+    std::uint32_t crc = i;
+    for (int bit = 0; bit < 8; ++bit) {
+      crc = (crc & 1U) != 0U ? (crc >> 1U) ^ 0xEDB88320U : crc >> 1U;
+    }
+    table[i] = crc;
+  }
+  return table;
+}
+
+constexpr ::estd::Array<std::uint32_t, 256U> kCrc32Table = make_crc32_table();
+
+// fill and comparison of bytewise types need the compiler to tell constant evaluation apart
+#if ESTD_HAS_CONSTANT_EVALUATED
+constexpr ::estd::Array<unsigned char, 4U> make_filled(unsigned char value) {
+  ::estd::Array<unsigned char, 4U> a{};
+  a.fill(value);
+  return a;
+}
+
+constexpr ::estd::Array<int, 3U> make_swapped() {
+  ::estd::Array<int, 3U> a{1, 2, 3};
+  ::estd::Array<int, 3U> b{4, 5, 6};
+  ::estd::swap(a, b);
+  return a;
+}
+#endif
+
+} // namespace
+
+TEST(Array, constexpr_lookup_table) {
+  static_assert(kCrc32Table[0U] == 0x00000000U, "");
+  static_assert(kCrc32Table[1U] == 0x77073096U, "");
+  static_assert(kCrc32Table.back() == 0x2D02EF8DU, "");
+  static_assert(kCrc32Table.size() == 256U, "");
+  std::uint32_t crc = 0xFFFFFFFFU;
+  for (char c : std::string{"123456789"}) {
+    crc = kCrc32Table[(crc ^ static_cast<std::uint8_t>(c)) & 0xFFU] ^ (crc >> 8U);
+  }
+  EXPECT_EQ(crc ^ 0xFFFFFFFFU, 0xCBF43926U);
+}
+
+#if ESTD_HAS_CONSTANT_EVALUATED
+TEST(Array, constexpr_access_and_compare) {
+  constexpr ::estd::Array<int, 3U> a = ::estd::to_array(1, 2, 3);
+  constexpr ::estd::Array<unsigned char, 4U> bytes = make_filled(7U);
+  static_assert(::estd::get<0U>(a) == 1, "");
+  static_assert(::estd::get<2U>(::estd::to_array(1, 2, 3)) == 3, "");
+  static_assert(a.front() == 1 && a.at(1U) == 2 && *(a.end() - 1) == 3, "");
+  static_assert(a == ::estd::to_array(1, 2, 3) && a != ::estd::to_array(1, 2, 4), "");
+  static_assert(a < ::estd::to_array(1, 3, 0) && ::estd::to_array(1, 3, 0) > a, "");
+  static_assert(bytes[3U] == 7U && bytes == make_filled(7U) && bytes < make_filled(8U), "");
+  static_assert(make_swapped() == ::estd::to_array(4, 5, 6), "");
+}
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @File Name: benchmark.h
+ * @author Congcong Cai (congcongcai0907@163.com)
+ * @Creat Date : 2026-10-16
+ * @copyright Copyright (c) {2022} Congcong Cai
+ */
+
+#ifndef __estd__tests__benchmark__
+#define __estd__tests__benchmark__
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench {
+
+/**
+ * @brief user space retired instruction counter, invalid when perf event is not available.
+ */
+class InstructionCounter {
+public:
+  InstructionCounter() noexcept {
+#if defined(__linux__)
+    perf_event_attr attr{};
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    fd_ = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+  }
+  ~InstructionCounter() {
+#if defined(__linux__)
+    if (valid()) {
+      close(fd_);
+    }
+#endif
+  }
+  InstructionCounter(InstructionCounter const &) = delete;
+  InstructionCounter &operator=(InstructionCounter const &) = delete;
+
+  bool valid() const noexcept { return fd_ >= 0; }
+
+  void start() noexcept {
+#if defined(__linux__)
+    if (valid()) {
+      ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+  std::uint64_t stop() noexcept {
+    std::uint64_t count = 0U;
+#if defined(__linux__)
+    if (valid()) {
+      ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd_, &count, sizeof(count)) != sizeof(count)) {
+        count = 0U;
+      }
+    }
+#endif
+    return count;
+  }
+
+private:
+  int fd_{-1};
+};
+
+/**
+ * @brief prevent compiler from optimizing away value.
+ */
+template <class T> inline void do_not_optimize(T const &value) noexcept {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief run fn once and print time and instruction count per operation.
+ * @param  name: benchmark name
+ * @param  ops: number of operations done by fn
+ * @param  fn: benchmark body
+ * @return double: nanoseconds per operation
+ */
+template <class Fn> double run(char const *name, std::size_t ops, Fn &&fn) {
+  InstructionCounter counter{};
+  auto const begin = std::chrono::steady_clock::now();
+  counter.start();
+  fn();
+  std::uint64_t const instructions = counter.stop();
+  auto const end = std::chrono::steady_clock::now();
+  double const ns = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(ops);
+  if (counter.valid()) {
+    std::printf("%-48s %10.3f ns/op %10.2f instr/op\n", name, ns,
+                static_cast<double>(instructions) / static_cast<double>(ops));
+  } else {
+    std::printf("%-48s %10.3f ns/op %10s instr/op\n", name, ns, "n/a");
+  }
+  return ns;
+}
+
+}; // namespace bench
+
+#endif
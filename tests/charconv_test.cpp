@@ -0,0 +1,88 @@
+#include "charconv.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+template <class T> std::string format(T value) {
+  char buffer[24];
+  char *const last = ::estd::to_chars(buffer, buffer + sizeof(buffer), value);
+  return last == nullptr ? std::string{"<overflow>"} : std::string{buffer, last};
+}
+
+template <class T> bool parse(std::string const &text, T &value) {
+  char const *const last = text.data() + text.size();
+  return ::estd::from_chars(text.data(), last, value) == last;
+}
+
+} // namespace
+
+TEST(Charconv, to_chars_limits) {
+  EXPECT_EQ(format(0), "0");
+  EXPECT_EQ(format(9), "9");
+  EXPECT_EQ(format(10), "10");
+  EXPECT_EQ(format(-7), "-7");
+  EXPECT_EQ(format(std::numeric_limits<std::int8_t>::min()), "-128");
+  EXPECT_EQ(format(std::numeric_limits<std::uint8_t>::max()), "255");
+  EXPECT_EQ(format(std::numeric_limits<std::int32_t>::min()), "-2147483648");
+  EXPECT_EQ(format(std::numeric_limits<std::int64_t>::min()), "-9223372036854775808");
+  EXPECT_EQ(format(std::numeric_limits<std::uint64_t>::max()), "18446744073709551615");
+}
+
+TEST(Charconv, to_chars_buffer_too_small) {
+  char buffer[4] = {'x', 'x', 'x', 'x'};
+  EXPECT_EQ(::estd::to_chars(buffer, buffer + 3, 1234), nullptr);
+  EXPECT_EQ(buffer[0], 'x');
+  EXPECT_EQ(::estd::to_chars(buffer, buffer + 4, -1234), nullptr);
+  EXPECT_EQ(::estd::to_chars(buffer, buffer + 4, 1234), buffer + 4);
+  EXPECT_EQ(std::string(buffer, 4), "1234");
+}
+
+TEST(Charconv, from_chars_partial_and_errors) {
+  std::string const text{"123abc"};
+  int value = -1;
+  EXPECT_EQ(::estd::from_chars(text.data(), text.data() + text.size(), value), text.data() + 3);
+  EXPECT_EQ(value, 123);
+
+  value = -1;
+  EXPECT_FALSE(parse(std::string{""}, value));
+  EXPECT_FALSE(parse(std::string{"-"}, value));
+  EXPECT_FALSE(parse(std::string{"+1"}, value));
+  EXPECT_EQ(value, -1);
+
+  std::uint8_t byte = 0U;
+  EXPECT_TRUE(parse(std::string{"255"}, byte));
+  EXPECT_EQ(byte, 255U);
+  EXPECT_FALSE(parse(std::string{"256"}, byte));
+  EXPECT_FALSE(parse(std::string{"-1"}, byte));
+  EXPECT_EQ(byte, 255U);
+
+  std::int8_t small = 0;
+  EXPECT_TRUE(parse(std::string{"-128"}, small));
+  EXPECT_EQ(small, -128);
+  EXPECT_FALSE(parse(std::string{"128"}, small));
+  EXPECT_FALSE(parse(std::string{"-129"}, small));
+
+  std::int64_t wide = 0;
+  EXPECT_TRUE(parse(std::string{"-9223372036854775808"}, wide));
+  EXPECT_EQ(wide, std::numeric_limits<std::int64_t>::min());
+  EXPECT_FALSE(parse(std::string{"9223372036854775808"}, wide));
+  std::uint64_t unsigned_wide = 0U;
+  EXPECT_TRUE(parse(std::string{"18446744073709551615"}, unsigned_wide));
+  EXPECT_FALSE(parse(std::string{"18446744073709551616"}, unsigned_wide));
+}
+
+TEST(Charconv, round_trip_random) {
+  std::mt19937_64 random{1U};
+  for (int i = 0; i < 10000; ++i) {
+    std::int64_t const value = static_cast<std::int64_t>(random()) >> (random() % 64U);
+    std::string const text = format(value);
+    EXPECT_EQ(text, std::to_string(value));
+    std::int64_t parsed = 0;
+    EXPECT_TRUE(parse(text, parsed));
+    EXPECT_EQ(parsed, value);
+  }
+}
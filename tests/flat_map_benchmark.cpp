@@ -0,0 +1,75 @@
+#include "benchmark.h"
+#include "flat_map.h"
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kLookup = 1000000U;
+
+template <std::size_t N> void run_size() {
+  using SortedMap = ::estd::FlatMap<std::uint32_t, std::uint32_t, N>;
+  using EytzingerMap = ::estd::FlatMap<std::uint32_t, std::uint32_t, N, ::estd::less, ::estd::FlatLayout::eytzinger>;
+  static SortedMap sorted{};
+  static EytzingerMap eytzinger{};
+  std::mt19937 random{static_cast<std::uint32_t>(N)};
+  std::vector<std::uint32_t> keys(N);
+  std::vector<std::uint32_t> values(N);
+  std::map<std::uint32_t, std::uint32_t> std_map{};
+  for (std::size_t i = 0U; i < N; ++i) {
+    keys[i] = static_cast<std::uint32_t>(random());
+    values[i] = static_cast<std::uint32_t>(i);
+    std_map.emplace(keys[i], values[i]);
+  }
+  std::vector<std::uint32_t> lookups(kLookup);
+  for (std::uint32_t &key : lookups) {
+    key = keys[random() % N];
+  }
+  char name[96];
+
+  std::snprintf(name, sizeof(name), "FlatMap insert one by one n=%zu", N);
+  bench::run(name, N, [&keys, &values]() {
+    sorted.clear();
+    for (std::size_t i = 0U; i < N; ++i) {
+      sorted.insert(keys[i], values[i]);
+    }
+  });
+  std::snprintf(name, sizeof(name), "FlatMap build_from_unsorted n=%zu", N);
+  std::vector<typename SortedMap::index_type> scratch(N);
+  bench::run(name, N, [&keys, &values, &scratch]() {
+    sorted.build_from_unsorted(keys.data(), values.data(), N, scratch.data());
+  });
+  eytzinger.build_from_unsorted(keys.data(), values.data(), N, scratch.data());
+
+  std::snprintf(name, sizeof(name), "std::map find n=%zu", N);
+  bench::run(name, kLookup, [&std_map, &lookups]() {
+    for (std::uint32_t key : lookups) {
+      bench::do_not_optimize(std_map.find(key)->second);
+    }
+  });
+  std::snprintf(name, sizeof(name), "FlatMap sorted find n=%zu", N);
+  bench::run(name, kLookup, [&lookups]() {
+    for (std::uint32_t key : lookups) {
+      bench::do_not_optimize(*sorted.find(key));
+    }
+  });
+  std::snprintf(name, sizeof(name), "FlatMap eytzinger find n=%zu", N);
+  bench::run(name, kLookup, [&lookups]() {
+    for (std::uint32_t key : lookups) {
+      bench::do_not_optimize(*eytzinger.find(key));
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_size<64U>();
+  run_size<1024U>();
+  run_size<16384U>();
+  run_size<65000U>();
+  return 0;
+}
@@ -0,0 +1,156 @@
+#include "flat_map.h"
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using EytzingerMap = ::estd::FlatMap<std::uint32_t, std::uint32_t, 1000, ::estd::less, ::estd::FlatLayout::eytzinger>;
+
+} // namespace
+
+TEST(FlatSet, insert_erase_contains) {
+  ::estd::FlatSet<int, 8> set{};
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(3));
+  EXPECT_TRUE(set.insert(1));
+  EXPECT_TRUE(set.insert(2));
+  EXPECT_FALSE(set.insert(2));
+  EXPECT_EQ(set.size(), 3U);
+  EXPECT_EQ(set.key_at(0), 1);
+  EXPECT_EQ(set.key_at(1), 2);
+  EXPECT_EQ(set.key_at(2), 3);
+  EXPECT_TRUE(set.contains(2));
+  EXPECT_FALSE(set.contains(4));
+  EXPECT_EQ(set.erase(2), 1U);
+  EXPECT_EQ(set.erase(2), 0U);
+  EXPECT_FALSE(set.contains(2));
+  EXPECT_EQ(set.size(), 2U);
+  EXPECT_EQ(set.index_of(3), 1U);
+  EXPECT_EQ(set.index_of(5), set.npos);
+}
+
+TEST(FlatSet, build_from_unsorted) {
+  int const keys[] = {5, 3, 9, 3, 1, 5, 7};
+  ::estd::FlatSet<int, 8> set{};
+  ::estd::FlatSet<int, 8>::index_type scratch[7];
+  set.build_from_unsorted(keys, 7U, scratch);
+  ASSERT_EQ(set.size(), 5U);
+  EXPECT_TRUE(std::is_sorted(set.keys(), set.keys() + set.size()));
+  for (int key : keys) {
+    EXPECT_TRUE(set.contains(key));
+  }
+}
+
+TEST(FlatSetDeathTest, insert_full) {
+  ::estd::FlatSet<int, 2> set{};
+  set.insert(1);
+  set.insert(2);
+  ASSERT_DEATH(set.insert(3), "");
+}
+
+TEST(FlatMap, insert_find_erase) {
+  ::estd::FlatMap<int, std::string, 8> map{};
+  EXPECT_TRUE(map.insert(2, "two"));
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_TRUE(map.insert_or_assign(3, "three"));
+  map[0] = "zero";
+  EXPECT_EQ(map.size(), 4U);
+  EXPECT_EQ(map.value_at(0), "zero");
+  EXPECT_EQ(map.value_at(3), "three");
+  ASSERT_NE(map.find(2), nullptr);
+  EXPECT_EQ(*map.find(2), "two");
+  EXPECT_EQ(map.find(5), nullptr);
+  EXPECT_EQ(map.erase(2), 1U);
+  EXPECT_EQ(map.find(2), nullptr);
+  EXPECT_EQ(map.at(3), "three");
+  EXPECT_TRUE(map[7].empty());
+}
+
+TEST(FlatMap, build_from_unsorted_keeps_first) {
+  int const keys[] = {4, 2, 4, 1};
+  int const values[] = {40, 20, 41, 10};
+  ::estd::FlatMap<int, int, 4> map{};
+  ::estd::FlatMap<int, int, 4>::index_type scratch[4];
+  map.build_from_unsorted(keys, values, 4U, scratch);
+  ASSERT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at(1), 10);
+  EXPECT_EQ(map.at(2), 20);
+  EXPECT_EQ(map.at(4), 40);
+}
+
+TEST(FlatMap, random_against_std_map) {
+  std::mt19937 random{1U};
+  std::map<std::uint32_t, std::uint32_t> expected{};
+  ::estd::FlatMap<std::uint32_t, std::uint32_t, 256> map{};
+  for (int i = 0; i < 10000; ++i) {
+    std::uint32_t const key = random() % 300U;
+    if (random() % 2U == 0U && expected.size() < 256U) {
+      EXPECT_EQ(map.insert(key, i), expected.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  std::size_t index = 0U;
+  for (auto const &element : expected) {
+    EXPECT_EQ(map.key_at(index), element.first);
+    EXPECT_EQ(map.value_at(index), element.second);
+    ++index;
+  }
+}
+
+TEST(FlatMap, eytzinger_layout) {
+  std::mt19937 random{2U};
+  std::vector<std::uint32_t> keys(1000U);
+  std::vector<std::uint32_t> values(1000U);
+  std::map<std::uint32_t, std::uint32_t> expected{};
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = random() % 5000U;
+    values[i] = static_cast<std::uint32_t>(i);
+    expected.emplace(keys[i], values[i]);
+  }
+  static EytzingerMap map{};
+  std::vector<EytzingerMap::index_type> scratch(keys.size());
+  map.build_from_unsorted(keys.data(), values.data(), keys.size(), scratch.data());
+  ASSERT_EQ(map.size(), expected.size());
+  for (std::uint32_t key = 0U; key < 5100U; ++key) {
+    auto const it = expected.find(key);
+    std::uint32_t const *const value = map.find(key);
+    if (it == expected.end()) {
+      EXPECT_EQ(value, nullptr) << key;
+    } else {
+      ASSERT_NE(value, nullptr) << key;
+      EXPECT_EQ(*value, it->second) << key;
+    }
+  }
+}
+
+TEST(FlatMap, eytzinger_small) {
+  for (std::size_t size = 0U; size <= 16U; ++size) {
+    std::vector<int> keys{};
+    for (std::size_t i = 0; i < size; ++i) {
+      keys.push_back(static_cast<int>(size - i) * 2);
+    }
+    ::estd::FlatSet<int, 16, ::estd::less, ::estd::FlatLayout::eytzinger> set{};
+    ::estd::Array<decltype(set)::index_type, 16> scratch{};
+    set.build_from_unsorted(keys.data(), keys.size(), scratch.data());
+    ASSERT_EQ(set.size(), size);
+    for (int key = -1; key <= 34; ++key) {
+      EXPECT_EQ(set.contains(key), key > 0 && key % 2 == 0 && key <= static_cast<int>(size) * 2) << size << " " << key;
+    }
+  }
+}
+
+TEST(FlatMapDeathTest, at_missing) {
+  ::estd::FlatMap<int, int, 4> map{};
+  ASSERT_DEATH(map.at(1), "");
+}
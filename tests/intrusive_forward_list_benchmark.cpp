@@ -0,0 +1,76 @@
+#include "benchmark.h"
+#include "intrusive_forward_list.h"
+#include "intrusive_list.h"
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kNodeCount = 1U << 20U;
+constexpr std::size_t kRound = 16U;
+
+struct ForwardST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ForwardST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ForwardST, node_); }
+  };
+  using Node = ::estd::IntrusiveForwardListNode<ForwardST, NodeTraits>;
+  using List = ::estd::IntrusiveForwardList<Node>;
+  std::uint32_t value_{};
+  Node node_{};
+};
+
+struct ListST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ListST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ListST, node_); }
+  };
+  using Node = ::estd::IntrusiveListNode<ListST, NodeTraits>;
+  using List = ::estd::IntrusiveList<Node>;
+  std::uint32_t value_{};
+  Node node_{};
+};
+
+template <class ST> void run_suite(char const *prefix) {
+  using List = typename ST::List;
+  std::printf("%s: sizeof(node)=%zu sizeof(element)=%zu memory=%zu KiB\n", prefix, sizeof(typename ST::Node),
+              sizeof(ST), sizeof(ST) * kNodeCount / 1024U);
+  std::vector<ST> data(kNodeCount);
+  for (std::size_t i = 0U; i < data.size(); ++i) {
+    data[i].value_ = static_cast<std::uint32_t>(i);
+  }
+  char name[64];
+
+  List list{};
+  std::snprintf(name, sizeof(name), "%s push_back/pop_front", prefix);
+  bench::run(name, kNodeCount * kRound, [&data, &list]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      for (ST &st : data) {
+        list.push_back(st);
+      }
+      while (!list.empty()) {
+        list.pop_front();
+      }
+    }
+  });
+
+  for (ST &st : data) {
+    list.push_back(st);
+  }
+  std::snprintf(name, sizeof(name), "%s iterate", prefix);
+  bench::run(name, kNodeCount * kRound, [&list]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      std::uint32_t sum = 0U;
+      for (ST const &st : list) {
+        sum += st.value_;
+      }
+      bench::do_not_optimize(sum);
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_suite<ForwardST>("IntrusiveForwardList");
+  run_suite<ListST>("IntrusiveList");
+  return 0;
+}
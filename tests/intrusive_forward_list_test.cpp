@@ -0,0 +1,91 @@
+#include "intrusive_forward_list.h"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <list>
+#include <vector>
+
+struct ST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, node_); }
+  };
+  explicit ST(int v) : value_{v}, node_{} {}
+  int value_;
+  ::estd::IntrusiveForwardListNode<ST, NodeTraits> node_;
+};
+
+using STNode = ::estd::IntrusiveForwardListNode<ST, ST::NodeTraits>;
+using STList = ::estd::IntrusiveForwardList<STNode>;
+
+bool operator==(ST const &lhs, ST const &rhs) { return lhs.value_ == rhs.value_; }
+
+bool operator==(STList const &lhs, std::list<int> const &rhs) noexcept {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  auto rit = rhs.begin();
+  for (auto lit = lhs.begin(); lit != lhs.end(); ++lit, ++rit) {
+    if (lit->value_ != *rit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(IntrusiveForwardListNode, size) { EXPECT_EQ(sizeof(STNode), sizeof(void *)); }
+
+TEST(IntrusiveForwardList, push_and_pop) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}};
+  STList list{};
+  EXPECT_TRUE(list.empty());
+  list.push_back(data[1]);
+  list.push_back(data[2]);
+  list.push_front(data[0]);
+  list.push_back(data[3]);
+  EXPECT_EQ(list, (std::list<int>{1, 2, 3, 4}));
+  EXPECT_EQ(&list.front(), &data[0]);
+  EXPECT_EQ(&list.back(), &data[3]);
+
+  list.pop_front();
+  list.pop_front();
+  EXPECT_EQ(list, (std::list<int>{3, 4}));
+  list.pop_front();
+  list.pop_front();
+  EXPECT_TRUE(list.empty());
+
+  // tail is reset when list becomes empty
+  list.push_back(data[2]);
+  EXPECT_EQ(list, (std::list<int>{3}));
+  EXPECT_EQ(&list.back(), &data[2]);
+}
+
+TEST(IntrusiveForwardList, insert_and_erase_after) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}};
+  STList list{};
+  auto it = list.insert_after(list.before_begin(), data[0]);
+  it = list.insert_after(it, data[2]);
+  list.insert_after(list.begin(), data[1]);
+  EXPECT_EQ(list, (std::list<int>{1, 2, 3}));
+  EXPECT_EQ(&list.back(), &data[2]);
+
+  // erase tail then append
+  auto last = list.erase_after(list.begin() /* 1 */);
+  EXPECT_EQ(last->value_, 3);
+  list.erase_after(list.begin());
+  EXPECT_EQ(list, (std::list<int>{1}));
+  EXPECT_EQ(&list.back(), &data[0]);
+  list.push_back(data[3]);
+  EXPECT_EQ(list, (std::list<int>{1, 4}));
+}
+
+TEST(IntrusiveForwardList, remove_if) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}, ST{5}, ST{6}};
+  STList list{};
+  for (ST &st : data) {
+    list.push_back(st);
+  }
+  EXPECT_EQ(list.remove_if([](ST const &st) { return st.value_ % 2 == 0; }), 3U);
+  EXPECT_EQ(list, (std::list<int>{1, 3, 5}));
+  EXPECT_EQ(&list.back(), &data[4]);
+  EXPECT_EQ(list.remove(ST{1}), 1U);
+  EXPECT_EQ(list, (std::list<int>{3, 5}));
+}
@@ -0,0 +1,179 @@
+#include "intrusive_hash_table.h"
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <set>
+#include <vector>
+
+namespace {
+
+struct Connection {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Connection, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Connection, node_); }
+  };
+  using Node = ::estd::IntrusiveListNode<Connection, NodeTraits>;
+  struct KeyOf {
+    unsigned int const &operator()(Connection const &connection) const noexcept { return connection.id_; }
+  };
+
+  Connection() noexcept = default;
+  explicit Connection(unsigned int id) noexcept : id_{id} {}
+
+  unsigned int id_{};
+  Node node_{};
+};
+
+// every key collides into one bucket
+struct ConstantHash {
+  std::size_t operator()(unsigned int) const noexcept { return 0U; }
+};
+
+using Table = ::estd::IntrusiveHashTable<Connection::Node, Connection::KeyOf>;
+
+} // namespace
+
+TEST(IntrusiveHashTable, insert_find_erase) {
+  ::estd::Array<Table::Bucket, 8> buckets{};
+  Table table{buckets};
+  Connection a{1U};
+  Connection b{2U};
+  Connection c{9U};
+  Connection duplicate{1U};
+  EXPECT_TRUE(table.empty());
+  EXPECT_TRUE(table.insert(a));
+  EXPECT_TRUE(table.insert(b));
+  EXPECT_TRUE(table.insert(c));
+  EXPECT_FALSE(table.insert(duplicate));
+  EXPECT_EQ(table.size(), 3U);
+  EXPECT_EQ(table.bucket_count(), 8U);
+  EXPECT_EQ(table.find(1U), &a);
+  EXPECT_EQ(table.find(2U), &b);
+  EXPECT_EQ(table.find(9U), &c);
+  EXPECT_EQ(table.find(3U), nullptr);
+
+  table.erase(b);
+  EXPECT_EQ(table.find(2U), nullptr);
+  EXPECT_EQ(table.erase(9U), &c);
+  EXPECT_EQ(table.erase(9U), nullptr);
+  EXPECT_EQ(table.size(), 1U);
+  EXPECT_FLOAT_EQ(table.load_factor(), 1.0F / 8.0F);
+}
+
+TEST(IntrusiveHashTable, erase_element_keeps_size) {
+  ::estd::Array<Table::Bucket, 4> buckets{};
+  Table table{buckets};
+  std::vector<Connection> connections{};
+  for (unsigned int id = 0U; id < 8U; ++id) {
+    connections.emplace_back(id);
+  }
+  for (Connection &connection : connections) {
+    EXPECT_TRUE(table.insert(connection));
+  }
+  EXPECT_FLOAT_EQ(table.load_factor(), 2.0F);
+  for (std::size_t i = 0U; i < connections.size(); ++i) {
+    table.erase(connections[i]);
+    EXPECT_EQ(table.size(), connections.size() - i - 1U);
+    EXPECT_EQ(table.find(connections[i].id_), nullptr);
+  }
+  EXPECT_TRUE(table.empty());
+  EXPECT_FLOAT_EQ(table.load_factor(), 0.0F);
+  std::size_t visited = 0U;
+  table.for_each([&visited](Connection &) { ++visited; });
+  EXPECT_EQ(visited, 0U);
+  // erased elements can be inserted again
+  EXPECT_TRUE(table.insert(connections[3]));
+  EXPECT_EQ(table.size(), 1U);
+  EXPECT_EQ(table.find(3U), &connections[3]);
+}
+
+TEST(IntrusiveHashTable, element_unlinks_itself) {
+  ::estd::Array<Table::Bucket, 4> buckets{};
+  Table table{buckets};
+  Connection a{1U};
+  Connection b{2U};
+  Connection c{5U};
+  EXPECT_TRUE(table.insert(a));
+  EXPECT_TRUE(table.insert(b));
+  EXPECT_TRUE(table.insert(c));
+  // a closed connection removes itself without knowing the table
+  b.node_.erase();
+  EXPECT_EQ(table.size(), 2U);
+  EXPECT_EQ(table.find(2U), nullptr);
+  EXPECT_FLOAT_EQ(table.load_factor(), 2.0F / 4.0F);
+  a.node_.erase();
+  c.node_.erase();
+  EXPECT_TRUE(table.empty());
+  EXPECT_EQ(table.size(), 0U);
+  EXPECT_TRUE(table.insert(b));
+  EXPECT_EQ(table.find(2U), &b);
+  EXPECT_EQ(table.size(), 1U);
+}
+
+TEST(IntrusiveHashTable, collisions) {
+  ::estd::Array<::estd::IntrusiveHashTable<Connection::Node, Connection::KeyOf, ConstantHash>::Bucket, 2> buckets{};
+  ::estd::IntrusiveHashTable<Connection::Node, Connection::KeyOf, ConstantHash> table{buckets};
+  std::vector<Connection> connections(10U);
+  for (unsigned int i = 0U; i < connections.size(); ++i) {
+    connections[i].id_ = i;
+    EXPECT_TRUE(table.insert(connections[i]));
+  }
+  table.erase(connections[4]);
+  for (unsigned int i = 0U; i < connections.size(); ++i) {
+    EXPECT_EQ(table.find(i), i == 4U ? nullptr : &connections[i]);
+  }
+  EXPECT_TRUE(buckets[1].empty());
+}
+
+TEST(IntrusiveHashTable, incremental_rehash) {
+  ::estd::Array<Table::Bucket, 4> small{};
+  ::estd::Array<Table::Bucket, 64> large{};
+  Table table{small};
+  std::vector<Connection> connections(100U);
+  for (unsigned int i = 0U; i < 50U; ++i) {
+    connections[i].id_ = i;
+    EXPECT_TRUE(table.insert(connections[i]));
+  }
+  table.rehash(large);
+  EXPECT_TRUE(table.rehashing());
+  EXPECT_EQ(table.bucket_count(), 64U);
+  // lookups during rehash find elements in both storages
+  for (unsigned int i = 0U; i < 50U; ++i) {
+    EXPECT_EQ(table.find(i), &connections[i]);
+  }
+  EXPECT_FALSE(table.rehashing());
+  for (unsigned int i = 50U; i < 100U; ++i) {
+    connections[i].id_ = i;
+    EXPECT_TRUE(table.insert(connections[i]));
+  }
+  for (Table::Bucket const &bucket : small) {
+    EXPECT_TRUE(bucket.empty());
+  }
+  std::set<unsigned int> visited{};
+  table.for_each([&visited](Connection &connection) { visited.insert(connection.id_); });
+  EXPECT_EQ(visited.size(), 100U);
+  EXPECT_EQ(table.size(), 100U);
+}
+
+TEST(IntrusiveHashTable, mutate_during_rehash) {
+  ::estd::Array<Table::Bucket, 2> small{};
+  ::estd::Array<Table::Bucket, 16> large{};
+  Table table{small};
+  std::vector<Connection> connections(20U);
+  for (unsigned int i = 0U; i < 10U; ++i) {
+    connections[i].id_ = i;
+    table.insert(connections[i]);
+  }
+  table.rehash(large.data(), large.size());
+  connections[10].id_ = 10U;
+  EXPECT_TRUE(table.insert(connections[10]));
+  EXPECT_FALSE(table.insert(connections[3]));
+  table.erase(connections[7]);
+  std::set<unsigned int> visited{};
+  table.for_each([&visited](Connection &connection) { visited.insert(connection.id_); });
+  EXPECT_EQ(visited, (std::set<unsigned int>{0U, 1U, 2U, 3U, 4U, 5U, 6U, 8U, 9U, 10U}));
+  EXPECT_EQ(table.size(), 10U);
+}
+
+TEST(IntrusiveHashTableDeathTest, bucket_count_not_power_of_two) {
+  ::estd::Array<Table::Bucket, 3> buckets{};
+  ASSERT_DEATH((Table{buckets.data(), buckets.size()}), "");
+}
@@ -0,0 +1,97 @@
+#include "intrusive_index_list.h"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <list>
+
+struct ST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, node_); }
+  };
+  int value_;
+  ::estd::IntrusiveIndexListNode<std::uint16_t> node_;
+};
+
+using STList = ::estd::IntrusiveIndexList<ST, ST::NodeTraits, std::uint16_t>;
+
+bool operator==(ST const &lhs, ST const &rhs) { return lhs.value_ == rhs.value_; }
+
+bool operator==(STList const &lhs, std::list<int> const &rhs) noexcept {
+  if (lhs.size() != rhs.size()) {
+    return false;
+  }
+  auto rit = rhs.begin();
+  for (auto lit = lhs.begin(); lit != lhs.end(); ++lit, ++rit) {
+    if (lit->value_ != *rit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+TEST(IntrusiveIndexListNode, size) {
+  EXPECT_EQ(sizeof(::estd::IntrusiveIndexListNode<std::uint16_t>), 4U);
+  EXPECT_EQ(sizeof(::estd::IntrusiveIndexListNode<std::uint32_t>), 8U);
+}
+
+TEST(IntrusiveIndexList, push_and_pop) {
+  ::estd::Array<ST, 8> storage{};
+  for (int i = 0; i < 8; ++i) {
+    storage[i].value_ = i;
+  }
+  STList list{storage};
+  list.push_back(storage[1]);
+  list.push_back(storage[2]);
+  list.push_front(storage[0]);
+  list.push_back(storage[5]);
+  EXPECT_EQ(list, (std::list<int>{0, 1, 2, 5}));
+  EXPECT_EQ(list.front().value_, 0);
+  EXPECT_EQ(list.back().value_, 5);
+  EXPECT_EQ(list.begin().index(), 0U);
+
+  list.pop_back();
+  list.pop_front();
+  EXPECT_EQ(list, (std::list<int>{1, 2}));
+  list.pop_back();
+  list.pop_back();
+  EXPECT_TRUE(list.empty());
+  EXPECT_TRUE(list.begin() == list.end());
+}
+
+TEST(IntrusiveIndexList, insert_and_erase) {
+  ST storage[6] = {};
+  for (int i = 0; i < 6; ++i) {
+    storage[i].value_ = i;
+  }
+  STList list{storage};
+  auto it = list.insert(list.end(), storage[3]);
+  list.insert(it, storage[1]);
+  list.insert(list.end(), storage[4]);
+  EXPECT_EQ(list, (std::list<int>{1, 3, 4}));
+  it = list.erase(++list.begin());
+  EXPECT_EQ(it->value_, 4);
+  EXPECT_EQ(list, (std::list<int>{1, 4}));
+  EXPECT_EQ(list.remove(storage[4]), 1U);
+  EXPECT_EQ(list, (std::list<int>{1}));
+}
+
+TEST(IntrusiveIndexList, copy_storage) {
+  struct Pool {
+    ST storage_[4];
+    STList list_{storage_};
+  };
+  Pool pool{};
+  for (int i = 0; i < 4; ++i) {
+    pool.storage_[i].value_ = i * 10;
+  }
+  pool.list_.push_back(pool.storage_[2]);
+  pool.list_.push_back(pool.storage_[0]);
+
+  // copy whole pool bytewise, links are indices so only base is rebound
+  Pool copied{};
+  std::memcpy(static_cast<void *>(&copied), &pool, sizeof(Pool));
+  copied.list_.rebind(copied.storage_);
+  EXPECT_EQ(copied.list_, (std::list<int>{20, 0}));
+  EXPECT_EQ(&copied.list_.front(), &copied.storage_[2]);
+}
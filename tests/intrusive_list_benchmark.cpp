@@ -0,0 +1,94 @@
+#include "benchmark.h"
+#include "intrusive_list.h"
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kNodeCount = 1U << 16U;
+constexpr std::size_t kRound = 64U;
+
+struct FunctorST {
+  struct GetNode;
+  struct GetElement;
+  using Node = ::estd::IntrusiveListNode<FunctorST, GetNode, GetElement>;
+
+  struct GetNode {
+    Node *operator()(FunctorST *const element) noexcept { return &element->node_; }
+  };
+  struct GetElement {
+    FunctorST *operator()(Node *const node) noexcept {
+      return reinterpret_cast<FunctorST *>(reinterpret_cast<char *>(node) - offsetof(FunctorST, node_));
+    }
+    FunctorST const *operator()(Node const *const node) noexcept {
+      return reinterpret_cast<FunctorST const *>(reinterpret_cast<const char *>(node) - offsetof(FunctorST, node_));
+    }
+  };
+  int value_{};
+  Node node_{};
+};
+
+struct OffsetST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<OffsetST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(OffsetST, node_); }
+  };
+  using Node = ::estd::IntrusiveListNode<OffsetST, NodeTraits>;
+  int value_{};
+  Node node_{};
+};
+
+template <class ST> void run_suite(char const *prefix) {
+  using List = ::estd::IntrusiveList<typename ST::Node>;
+  std::vector<ST> data(kNodeCount);
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i].value_ = static_cast<int>(i);
+  }
+  char name[64];
+
+  std::snprintf(name, sizeof(name), "%s push_back", prefix);
+  bench::run(name, kNodeCount * kRound, [&data]() {
+    for (std::size_t r = 0; r < kRound; ++r) {
+      List list{};
+      for (ST &st : data) {
+        list.push_back(st);
+      }
+      bench::do_not_optimize(list.size());
+    }
+  });
+
+  std::snprintf(name, sizeof(name), "%s erase", prefix);
+  List list{};
+  bench::run(name, kNodeCount * kRound, [&data, &list]() {
+    for (std::size_t r = 0; r < kRound; ++r) {
+      for (ST &st : data) {
+        list.push_back(st);
+      }
+      while (!list.empty()) {
+        list.erase(list.begin());
+      }
+      bench::do_not_optimize(list.size());
+    }
+  });
+
+  for (ST &st : data) {
+    list.push_back(st);
+  }
+  std::snprintf(name, sizeof(name), "%s iterate", prefix);
+  bench::run(name, kNodeCount * kRound, [&list]() {
+    for (std::size_t r = 0; r < kRound; ++r) {
+      int sum = 0;
+      for (ST const &st : list) {
+        sum += st.value_;
+      }
+      bench::do_not_optimize(sum);
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_suite<FunctorST>("IntrusiveList<functor traits>");
+  run_suite<OffsetST>("IntrusiveList<offset traits>");
+  return 0;
+}
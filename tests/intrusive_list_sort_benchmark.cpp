@@ -0,0 +1,50 @@
+#include "benchmark.h"
+#include "intrusive_list.h"
+#include <cstdint>
+#include <list>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct ST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, node_); }
+  };
+  using Node = ::estd::IntrusiveListNode<ST, NodeTraits>;
+  std::uint32_t value_{};
+  Node node_{};
+};
+
+bool operator<(ST const &lhs, ST const &rhs) { return lhs.value_ < rhs.value_; }
+
+void run_size(std::size_t size) {
+  std::mt19937 random{static_cast<std::uint32_t>(size)};
+  std::vector<std::uint32_t> values(size);
+  for (std::uint32_t &value : values) {
+    value = random();
+  }
+  char name[64];
+
+  std::list<std::uint32_t> std_list(values.begin(), values.end());
+  std::snprintf(name, sizeof(name), "std::list::sort n=%zu", size);
+  bench::run(name, size, [&std_list]() { std_list.sort(); });
+
+  std::vector<ST> data(size);
+  ::estd::IntrusiveList<ST::Node> list{};
+  for (std::size_t i = 0U; i < size; ++i) {
+    data[i].value_ = values[i];
+    list.push_back(data[i]);
+  }
+  std::snprintf(name, sizeof(name), "IntrusiveList::sort n=%zu", size);
+  bench::run(name, size, [&list]() { list.sort(); });
+}
+
+} // namespace
+
+int main() {
+  for (std::size_t size = 1000U; size <= 1000000U; size *= 10U) {
+    run_size(size);
+  }
+  return 0;
+}
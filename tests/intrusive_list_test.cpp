@@ -119,6 +119,19 @@ TEST(IntrusiveList, push_and_pop) {
   EXPECT_EQ(list, expect);
 }
 
+TEST(IntrusiveList, front_and_back) {
+  STList list{};
+  ST st1{2};
+  ST st2{3};
+  list.push_back(st1);
+  EXPECT_EQ(&list.front(), &st1);
+  EXPECT_EQ(&list.back(), &st1);
+  list.push_back(st2);
+  STList const &const_list = list;
+  EXPECT_EQ(&const_list.front(), &st1);
+  EXPECT_EQ(&const_list.back(), &st2);
+}
+
 TEST(IntrusiveList, remove) {
   STList list{};
   std::list<ST> data{ST{1}, ST{2}, ST{3}, ST{4}, ST{5}, ST{6}};
@@ -238,4 +251,164 @@ TEST(IntrusiveListNode, remove_if_all) {
   expect.remove_if(p);
 
   EXPECT_EQ(remove_size, 6);
-}
\ No newline at end of file
+}
+struct OffsetST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<OffsetST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(OffsetST, node_); }
+  };
+  explicit OffsetST(int v) : value_{v}, node_{} {}
+  int value_;
+  ::estd::IntrusiveListNode<OffsetST, NodeTraits> node_;
+};
+
+using OffsetSTNode = ::estd::IntrusiveListNode<OffsetST, OffsetST::NodeTraits>;
+using OffsetSTList = ::estd::IntrusiveList<OffsetSTNode>;
+
+TEST(IntrusiveListOffsetTraits, convert) {
+  OffsetST st{1};
+  EXPECT_EQ(OffsetSTNode::get_node(&st), &st.node_);
+  EXPECT_EQ(OffsetSTNode::get_element(&st.node_), &st);
+  OffsetSTNode const *const const_node = &st.node_;
+  EXPECT_EQ(OffsetSTNode::get_element(const_node), &st);
+}
+
+TEST(IntrusiveListOffsetTraits, push_and_iterate) {
+  OffsetSTList list{};
+  std::vector<OffsetST> data{OffsetST{1}, OffsetST{2}, OffsetST{3}};
+  for (OffsetST &st : data) {
+    list.push_back(st);
+  }
+  int expect = 1;
+  for (OffsetST const &st : list) {
+    EXPECT_EQ(st.value_, expect);
+    ++expect;
+  }
+  list.erase(list.begin());
+  EXPECT_EQ(list.size(), 2U);
+  EXPECT_EQ(list.begin()->value_, 2);
+}
+
+TEST(IntrusiveList, splice_list) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}, ST{5}};
+  STList list{};
+  STList other{};
+  list.push_back(data[0]);
+  list.push_back(data[4]);
+  for (int i = 1; i < 4; i++) {
+    other.push_back(data[i]);
+  }
+  list.splice(++list.begin(), other);
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{2}, ST{3}, ST{4}, ST{5}}));
+  EXPECT_EQ(list.size(), 5U);
+  EXPECT_TRUE(other.empty());
+  EXPECT_TRUE(other.begin() == other.end());
+}
+
+TEST(IntrusiveList, splice_element) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}};
+  STList list{};
+  STList other{};
+  list.push_back(data[0]);
+  list.push_back(data[1]);
+  other.push_back(data[2]);
+  other.push_back(data[3]);
+  list.splice(list.begin(), other, ++other.begin());
+  EXPECT_EQ(list, (std::list<ST>{ST{4}, ST{1}, ST{2}}));
+  EXPECT_EQ(other, (std::list<ST>{ST{3}}));
+  // move inside the same list
+  list.splice(list.end(), list, list.begin());
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{2}, ST{4}}));
+  EXPECT_EQ(list.size(), 3U);
+}
+
+TEST(IntrusiveList, splice_element_to_itself) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}};
+  STList list{};
+  for (ST &e : data) {
+    list.push_back(e);
+  }
+  // splicing an element before itself or before its successor does not move it
+  STList::iterator const it = ++list.begin();
+  list.splice(it, list, it);
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{2}, ST{3}}));
+  STList::iterator next = it;
+  list.splice(++next, list, it);
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{2}, ST{3}}));
+  EXPECT_EQ(list.size(), 3U);
+  // backward links are intact as well
+  for (::estd::size_t i = data.size(); i > 0U; --i) {
+    EXPECT_EQ(&list.back(), &data[i - 1U]);
+    list.pop_back();
+  }
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(IntrusiveList, splice_range) {
+  std::vector<ST> data{ST{1}, ST{2}, ST{3}, ST{4}, ST{5}, ST{6}};
+  STList list{};
+  STList other{};
+  list.push_back(data[0]);
+  list.push_back(data[1]);
+  for (int i = 2; i < 6; i++) {
+    other.push_back(data[i]);
+  }
+  auto first = ++other.begin();
+  auto last = first;
+  ++last;
+  ++last;
+  list.splice(++list.begin(), other, first, last);
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{4}, ST{5}, ST{2}}));
+  EXPECT_EQ(other, (std::list<ST>{ST{3}, ST{6}}));
+
+  list.splice(list.begin(), other, other.begin(), other.end(), 2U);
+  EXPECT_EQ(list, (std::list<ST>{ST{3}, ST{6}, ST{1}, ST{4}, ST{5}, ST{2}}));
+  EXPECT_TRUE(other.empty());
+}
+
+TEST(IntrusiveList, merge) {
+  std::vector<ST> data{ST{1}, ST{3}, ST{5}, ST{2}, ST{3}, ST{6}};
+  STList list{};
+  STList other{};
+  for (int i = 0; i < 3; i++) {
+    list.push_back(data[i]);
+    other.push_back(data[i + 3]);
+  }
+  list.merge(other, [](ST const &lhs, ST const &rhs) { return lhs.value_ < rhs.value_; });
+  EXPECT_EQ(list, (std::list<ST>{ST{1}, ST{2}, ST{3}, ST{3}, ST{5}, ST{6}}));
+  EXPECT_TRUE(other.empty());
+  // equivalent element of *this precede
+  auto it = ++(++list.begin());
+  EXPECT_EQ(&*it, &data[1]);
+}
+
+TEST(IntrusiveList, sort) {
+  std::vector<ST> data{};
+  std::list<ST> expect{};
+  for (int i = 0; i < 1000; i++) {
+    data.emplace_back((i * 7919) % 257);
+  }
+  STList list{};
+  for (ST &st : data) {
+    list.push_back(st);
+    expect.push_back(st);
+  }
+  auto const less = [](ST const &lhs, ST const &rhs) { return lhs.value_ < rhs.value_; };
+  list.sort(less);
+  expect.sort(less);
+  EXPECT_EQ(list, expect);
+  EXPECT_EQ(list.size(), data.size());
+
+  // stable and backward links are restored
+  ST const *prev = nullptr;
+  for (ST const &st : list) {
+    if (prev != nullptr && prev->value_ == st.value_) {
+      EXPECT_LT(prev, &st);
+    }
+    prev = &st;
+  }
+  list.pop_back();
+  expect.pop_back();
+  list.pop_front();
+  expect.pop_front();
+  EXPECT_EQ(list, expect);
+}
@@ -0,0 +1,93 @@
+#include "intrusive_lock_free_stack.h"
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Block {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Block, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Block, node_); }
+  };
+  ::estd::IntrusiveListNode<Block, NodeTraits> node_{};
+  std::atomic<std::uint32_t> owner_{0U};
+};
+
+using BlockNode = ::estd::IntrusiveListNode<Block, Block::NodeTraits>;
+using BlockStack = ::estd::IntrusiveLockFreeStack<BlockNode>;
+using BlockList = ::estd::IntrusiveList<BlockNode>;
+
+} // namespace
+
+TEST(IntrusiveLockFreeStack, push_and_pop) {
+  BlockStack stack{};
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(stack.pop(), nullptr);
+  std::vector<Block> blocks(3U);
+  for (Block &block : blocks) {
+    stack.push(block);
+  }
+  EXPECT_FALSE(stack.empty());
+  EXPECT_EQ(stack.pop(), &blocks[2]);
+  EXPECT_EQ(stack.pop(), &blocks[1]);
+  stack.push(blocks[2]);
+  EXPECT_EQ(stack.pop(), &blocks[2]);
+  EXPECT_EQ(stack.pop(), &blocks[0]);
+  EXPECT_EQ(stack.pop(), nullptr);
+}
+
+TEST(IntrusiveLockFreeStack, drain_into_list_in_push_order) {
+  BlockStack stack{};
+  std::vector<Block> blocks(4U);
+  BlockList list{};
+  list.push_back(blocks[0]);
+  stack.push(blocks[1]);
+  stack.push(blocks[2]);
+  stack.push(blocks[3]);
+  EXPECT_EQ(stack.drain_into(list), 3U);
+  EXPECT_TRUE(stack.empty());
+  EXPECT_EQ(list.size(), 4U);
+  auto it = list.begin();
+  for (Block &block : blocks) {
+    EXPECT_EQ(&*it, &block);
+    ++it;
+  }
+  EXPECT_EQ(stack.drain_into(list), 0U);
+  EXPECT_EQ(list.size(), 4U);
+}
+
+// every thread repeatedly pops a block, checks nobody else owns it and pushes it back, which is the ABA pattern
+TEST(IntrusiveLockFreeStack, stress_pop_and_push_again) {
+  constexpr std::uint32_t kThread = 4U;
+  constexpr std::uint32_t kRound = 50000U;
+  BlockStack stack{};
+  std::vector<Block> blocks(8U);
+  for (Block &block : blocks) {
+    stack.push(block);
+  }
+  std::atomic<std::uint32_t> failures{0U};
+  std::vector<std::thread> threads{};
+  for (std::uint32_t t = 1U; t <= kThread; ++t) {
+    threads.emplace_back([&stack, &failures, t]() {
+      for (std::uint32_t i = 0U; i < kRound; ++i) {
+        Block *const block = stack.pop();
+        if (block == nullptr) {
+          continue;
+        }
+        if (block->owner_.exchange(t) != 0U) {
+          failures.fetch_add(1U);
+        }
+        block->owner_.store(0U);
+        stack.push(*block);
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(failures.load(), 0U);
+  BlockList list{};
+  EXPECT_EQ(stack.drain_into(list), blocks.size());
+}
@@ -0,0 +1,85 @@
+#include "benchmark.h"
+#include "intrusive_lock_free_stack.h"
+#include "intrusive_mpsc_queue.h"
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kProducer = 4U;
+constexpr std::size_t kPerProducer = 250000U;
+constexpr std::size_t kTotal = kProducer * kPerProducer;
+
+struct Message {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Message, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Message, node_); }
+  };
+  ::estd::IntrusiveListNode<Message, NodeTraits> node_{};
+  std::uint32_t payload_{0U};
+};
+
+using MessageNode = ::estd::IntrusiveListNode<Message, Message::NodeTraits>;
+using MessageList = ::estd::IntrusiveList<MessageNode>;
+
+// producers push every message, one consumer drains batches until all are received
+template <class Push, class Drain> void handoff(std::vector<Message> &messages, Push push, Drain drain) {
+  std::vector<std::thread> producers{};
+  for (std::size_t p = 0U; p < kProducer; ++p) {
+    producers.emplace_back([&messages, &push, p]() {
+      for (std::size_t i = 0U; i < kPerProducer; ++i) {
+        push(messages[p * kPerProducer + i]);
+      }
+    });
+  }
+  std::size_t received = 0U;
+  MessageList batch{};
+  while (received < kTotal) {
+    received += drain(batch);
+    while (!batch.empty()) {
+      batch.pop_front();
+    }
+  }
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+}
+
+} // namespace
+
+int main() {
+  std::vector<Message> messages(kTotal);
+
+  ::estd::IntrusiveMpscQueue<MessageNode> queue{};
+  bench::run("IntrusiveMpscQueue 4 producers drain_into", kTotal, [&messages, &queue]() {
+    handoff(
+        messages, [&queue](Message &message) { queue.push(message); },
+        [&queue](MessageList &batch) { return queue.drain_into(batch); });
+  });
+
+  ::estd::IntrusiveLockFreeStack<MessageNode> stack{};
+  bench::run("IntrusiveLockFreeStack 4 producers drain_into", kTotal, [&messages, &stack]() {
+    handoff(
+        messages, [&stack](Message &message) { stack.push(message); },
+        [&stack](MessageList &batch) { return stack.drain_into(batch); });
+  });
+
+  std::mutex mutex{};
+  MessageList locked{};
+  bench::run("std::mutex + IntrusiveList 4 producers splice", kTotal, [&messages, &mutex, &locked]() {
+    handoff(
+        messages,
+        [&mutex, &locked](Message &message) {
+          std::lock_guard<std::mutex> const lock{mutex};
+          locked.push_back(message);
+        },
+        [&mutex, &locked](MessageList &batch) {
+          std::lock_guard<std::mutex> const lock{mutex};
+          std::size_t const count = locked.size();
+          batch.splice(batch.end(), locked);
+          return count;
+        });
+  });
+  return 0;
+}
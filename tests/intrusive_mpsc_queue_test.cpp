@@ -0,0 +1,107 @@
+#include "intrusive_mpsc_queue.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Message {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Message, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Message, node_); }
+  };
+  ::estd::IntrusiveListNode<Message, NodeTraits> node_{};
+  std::uint32_t producer_{0U};
+  std::uint32_t sequence_{0U};
+};
+
+using MessageNode = ::estd::IntrusiveListNode<Message, Message::NodeTraits>;
+using MessageQueue = ::estd::IntrusiveMpscQueue<MessageNode>;
+using MessageList = ::estd::IntrusiveList<MessageNode>;
+
+} // namespace
+
+TEST(IntrusiveMpscQueue, push_and_pop) {
+  MessageQueue queue{};
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(queue.pop(), nullptr);
+  std::vector<Message> messages(3U);
+  for (Message &message : messages) {
+    queue.push(message);
+  }
+  EXPECT_FALSE(queue.empty());
+  for (Message &message : messages) {
+    EXPECT_EQ(queue.pop(), &message);
+  }
+  EXPECT_EQ(queue.pop(), nullptr);
+  EXPECT_TRUE(queue.empty());
+
+  // the same elements can be pushed again after pop
+  queue.push(messages[1]);
+  EXPECT_EQ(queue.pop(), &messages[1]);
+  EXPECT_EQ(queue.pop(), nullptr);
+}
+
+TEST(IntrusiveMpscQueue, drain_into_list) {
+  MessageQueue queue{};
+  std::vector<Message> messages(4U);
+  MessageList list{};
+  list.push_back(messages[0]);
+  queue.push(messages[1]);
+  queue.push(messages[2]);
+  queue.push(messages[3]);
+  EXPECT_EQ(queue.drain_into(list), 3U);
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(list.size(), 4U);
+  auto it = list.begin();
+  for (Message &message : messages) {
+    EXPECT_EQ(&*it, &message);
+    ++it;
+  }
+  EXPECT_EQ(queue.drain_into(list), 0U);
+}
+
+TEST(IntrusiveMpscQueue, stress) {
+  constexpr std::uint32_t kProducer = 4U;
+  constexpr std::uint32_t kPerProducer = 20000U;
+  MessageQueue queue{};
+  std::vector<Message> messages(kProducer * kPerProducer);
+  std::vector<std::thread> producers{};
+  for (std::uint32_t p = 0U; p < kProducer; ++p) {
+    producers.emplace_back([&queue, &messages, p]() {
+      for (std::uint32_t i = 0U; i < kPerProducer; ++i) {
+        Message &message = messages[p * kPerProducer + i];
+        message.producer_ = p;
+        message.sequence_ = i;
+        queue.push(message);
+      }
+    });
+  }
+  std::vector<std::uint32_t> next(kProducer, 0U);
+  std::uint32_t received = 0U;
+  MessageList batch{};
+  while (received < kProducer * kPerProducer) {
+    // alternate single pop and batch drain
+    Message *const message = queue.pop();
+    if (message != nullptr) {
+      ASSERT_EQ(message->sequence_, next[message->producer_]);
+      ++next[message->producer_];
+      ++received;
+    }
+    queue.drain_into(batch);
+    while (!batch.empty()) {
+      Message &front = batch.front();
+      batch.pop_front();
+      ASSERT_EQ(front.sequence_, next[front.producer_]);
+      ++next[front.producer_];
+      ++received;
+    }
+  }
+  for (std::thread &producer : producers) {
+    producer.join();
+  }
+  EXPECT_EQ(queue.pop(), nullptr);
+  for (std::uint32_t p = 0U; p < kProducer; ++p) {
+    EXPECT_EQ(next[p], kPerProducer);
+  }
+}
@@ -0,0 +1,69 @@
+#include "benchmark.h"
+#include "intrusive_pairing_heap.h"
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kTaskCount = 100000U;
+
+struct Task {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Task, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Task, node_); }
+  };
+  ::estd::IntrusivePairingHeapNode<Task, NodeTraits> node_{};
+  unsigned priority_{0U};
+};
+
+struct TaskLess {
+  bool operator()(Task const &lhs, Task const &rhs) const noexcept { return lhs.priority_ < rhs.priority_; }
+};
+
+using TaskHeap = ::estd::IntrusivePairingHeap<::estd::IntrusivePairingHeapNode<Task, Task::NodeTraits>, TaskLess>;
+
+} // namespace
+
+int main() {
+  std::mt19937 random{1U};
+  std::vector<Task> tasks(kTaskCount);
+  for (Task &task : tasks) {
+    task.priority_ = static_cast<unsigned>(random());
+  }
+  unsigned sum = 0U;
+
+  TaskHeap heap{};
+  bench::run("IntrusivePairingHeap push 100k", kTaskCount, [&heap, &tasks]() {
+    for (Task &task : tasks) {
+      heap.push(task);
+    }
+  });
+  bench::run("IntrusivePairingHeap decrease_key 100k", kTaskCount, [&heap, &tasks]() {
+    for (Task &task : tasks) {
+      task.priority_ /= 2U;
+      heap.decrease_key(task);
+    }
+  });
+  bench::run("IntrusivePairingHeap pop 100k", kTaskCount, [&heap, &sum]() {
+    while (!heap.empty()) {
+      sum += heap.top().priority_;
+      heap.pop();
+    }
+  });
+
+  std::priority_queue<unsigned, std::vector<unsigned>, std::greater<unsigned>> queue{};
+  bench::run("std::priority_queue push 100k", kTaskCount, [&queue, &tasks]() {
+    for (Task const &task : tasks) {
+      queue.push(task.priority_);
+    }
+  });
+  bench::run("std::priority_queue pop 100k", kTaskCount, [&queue, &sum]() {
+    while (!queue.empty()) {
+      sum += queue.top();
+      queue.pop();
+    }
+  });
+  bench::do_not_optimize(sum);
+  return 0;
+}
@@ -0,0 +1,169 @@
+#include "intrusive_pairing_heap.h"
+#include <deque>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+struct Task {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<Task, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(Task, node_); }
+  };
+  Task() : node_{}, priority_{0} {}
+  explicit Task(int priority) : node_{}, priority_{priority} {}
+  ::estd::IntrusivePairingHeapNode<Task, NodeTraits> node_;
+  int priority_;
+};
+
+struct TaskLess {
+  bool operator()(Task const &lhs, Task const &rhs) const noexcept { return lhs.priority_ < rhs.priority_; }
+};
+
+using TaskNode = ::estd::IntrusivePairingHeapNode<Task, Task::NodeTraits>;
+using TaskHeap = ::estd::IntrusivePairingHeap<TaskNode, TaskLess>;
+
+std::vector<int> drain(TaskHeap &heap) {
+  std::vector<int> priorities{};
+  while (!heap.empty()) {
+    priorities.push_back(heap.top().priority_);
+    heap.pop();
+  }
+  return priorities;
+}
+
+} // namespace
+
+// elements are declared before the heap, the heap unlinks them when it is destroyed
+TEST(IntrusivePairingHeap, empty) {
+  TaskHeap heap{};
+  EXPECT_TRUE(heap.empty());
+  EXPECT_EQ(heap.size(), 0U);
+}
+
+TEST(IntrusivePairingHeap, push_pop_ordered) {
+  std::deque<Task> tasks{};
+  for (int priority : {5, 3, 8, 1, 4, 7, 9, 2, 6}) {
+    tasks.emplace_back(priority);
+  }
+  TaskHeap heap{};
+  for (Task &task : tasks) {
+    heap.push(task);
+    EXPECT_TRUE(task.node_.is_linked());
+  }
+  EXPECT_EQ(heap.size(), 9U);
+  EXPECT_EQ(heap.top().priority_, 1);
+  EXPECT_EQ(drain(heap), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  for (Task const &task : tasks) {
+    EXPECT_FALSE(task.node_.is_linked());
+  }
+}
+
+TEST(IntrusivePairingHeap, decrease_key) {
+  std::deque<Task> tasks{};
+  for (int priority : {10, 20, 30, 40}) {
+    tasks.emplace_back(priority);
+  }
+  TaskHeap heap{};
+  for (Task &task : tasks) {
+    heap.push(task);
+  }
+  heap.pop();
+  tasks[3].priority_ = 5;
+  heap.decrease_key(tasks[3]);
+  EXPECT_EQ(&heap.top(), &tasks[3]);
+  tasks[3].priority_ = 1;
+  heap.decrease_key(tasks[3]);
+  EXPECT_EQ(&heap.top(), &tasks[3]);
+  EXPECT_EQ(drain(heap), (std::vector<int>{1, 20, 30}));
+}
+
+TEST(IntrusivePairingHeap, erase) {
+  std::deque<Task> tasks{};
+  for (int priority : {1, 2, 3, 4, 5}) {
+    tasks.emplace_back(priority);
+  }
+  TaskHeap heap{};
+  for (Task &task : tasks) {
+    heap.push(task);
+  }
+  heap.pop();
+  heap.erase(tasks[3]);
+  EXPECT_FALSE(tasks[3].node_.is_linked());
+  heap.erase(tasks[1]);
+  EXPECT_EQ(heap.size(), 2U);
+  EXPECT_EQ(drain(heap), (std::vector<int>{3, 5}));
+}
+
+TEST(IntrusivePairingHeap, clear_and_destroy_unlink) {
+  std::deque<Task> tasks{};
+  for (int priority = 0; priority < 100; ++priority) {
+    tasks.emplace_back(priority % 7);
+  }
+  {
+    TaskHeap heap{};
+    for (Task &task : tasks) {
+      heap.push(task);
+    }
+    heap.pop();
+    heap.clear();
+    EXPECT_TRUE(heap.empty());
+    for (Task const &task : tasks) {
+      EXPECT_FALSE(task.node_.is_linked());
+    }
+    for (Task &task : tasks) {
+      heap.push(task);
+    }
+    heap.pop();
+  }
+  for (Task const &task : tasks) {
+    EXPECT_FALSE(task.node_.is_linked());
+  }
+}
+
+TEST(IntrusivePairingHeap, random_compare_with_multiset) {
+  std::mt19937 random{3U};
+  std::vector<Task> tasks(1000U);
+  TaskHeap heap{};
+  std::multiset<int> expected{};
+  for (int round = 0; round < 20000; ++round) {
+    Task &task = tasks[random() % tasks.size()];
+    switch (random() % 4U) {
+    case 0U:
+      if (!heap.empty()) {
+        EXPECT_EQ(heap.top().priority_, *expected.begin());
+        expected.erase(expected.begin());
+        heap.pop();
+      }
+      break;
+    case 1U:
+      if (task.node_.is_linked()) {
+        expected.erase(expected.find(task.priority_));
+        heap.erase(task);
+      }
+      break;
+    case 2U:
+      if (task.node_.is_linked()) {
+        expected.erase(expected.find(task.priority_));
+        task.priority_ -= static_cast<int>(random() % 100U);
+        expected.insert(task.priority_);
+        heap.decrease_key(task);
+      }
+      break;
+    default:
+      if (!task.node_.is_linked()) {
+        task.priority_ = static_cast<int>(random() % 10000U);
+        expected.insert(task.priority_);
+        heap.push(task);
+      }
+      break;
+    }
+    ASSERT_EQ(heap.size(), expected.size());
+    if (!heap.empty()) {
+      ASSERT_EQ(heap.top().priority_, *expected.begin());
+    }
+  }
+  std::vector<int> const priorities = drain(heap);
+  EXPECT_EQ(priorities, std::vector<int>(expected.begin(), expected.end()));
+}
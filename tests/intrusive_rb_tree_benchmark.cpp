@@ -0,0 +1,104 @@
+#include "benchmark.h"
+#include "intrusive_list.h"
+#include "intrusive_rb_tree.h"
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+struct ST {
+  struct TreeTraits : ::estd::IntrusiveListOffsetTraits<ST, TreeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, tree_node_); }
+  };
+  struct ListTraits : ::estd::IntrusiveListOffsetTraits<ST, ListTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, list_node_); }
+  };
+  ::estd::IntrusiveRbTreeNode<ST, TreeTraits> tree_node_{};
+  ::estd::IntrusiveListNode<ST, ListTraits> list_node_{};
+  unsigned value_{0U};
+};
+
+struct STLess {
+  bool operator()(ST const &lhs, ST const &rhs) const noexcept { return lhs.value_ < rhs.value_; }
+  bool operator()(ST const &lhs, unsigned rhs) const noexcept { return lhs.value_ < rhs; }
+  bool operator()(unsigned lhs, ST const &rhs) const noexcept { return lhs < rhs.value_; }
+};
+
+using STTree = ::estd::IntrusiveRbTree<::estd::IntrusiveRbTreeNode<ST, ST::TreeTraits>, STLess>;
+using STList = ::estd::IntrusiveList<::estd::IntrusiveListNode<ST, ST::ListTraits>>;
+
+void run_size(std::size_t count, bool with_list) {
+  std::mt19937 random{1U};
+  std::vector<ST> sts(count);
+  for (ST &st : sts) {
+    st.value_ = static_cast<unsigned>(random());
+  }
+  char name[64];
+
+  STTree tree{};
+  std::snprintf(name, sizeof(name), "IntrusiveRbTree insert %zu", count);
+  bench::run(name, count, [&tree, &sts]() {
+    for (ST &st : sts) {
+      tree.insert(st);
+    }
+  });
+  std::size_t found = 0U;
+  std::snprintf(name, sizeof(name), "IntrusiveRbTree find %zu", count);
+  bench::run(name, count, [&tree, &sts, &found]() {
+    for (ST const &st : sts) {
+      found += tree.find(st.value_) != tree.end() ? 1U : 0U;
+    }
+  });
+  std::snprintf(name, sizeof(name), "IntrusiveRbTree unlink %zu", count);
+  bench::run(name, count, [&sts]() {
+    for (ST &st : sts) {
+      st.tree_node_.unlink();
+    }
+  });
+
+  std::set<unsigned> set{};
+  std::snprintf(name, sizeof(name), "std::set insert %zu", count);
+  bench::run(name, count, [&set, &sts]() {
+    for (ST const &st : sts) {
+      set.insert(st.value_);
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::set find %zu", count);
+  bench::run(name, count, [&set, &sts, &found]() {
+    for (ST const &st : sts) {
+      found += set.find(st.value_) != set.end() ? 1U : 0U;
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::set erase %zu", count);
+  bench::run(name, count, [&set, &sts]() {
+    for (ST const &st : sts) {
+      set.erase(st.value_);
+    }
+  });
+
+  if (with_list) {
+    STList list{};
+    std::snprintf(name, sizeof(name), "sorted IntrusiveList insert %zu", count);
+    bench::run(name, count, [&list, &sts]() {
+      for (ST &st : sts) {
+        auto it = list.begin();
+        while (it != list.end() && it->value_ < st.value_) {
+          ++it;
+        }
+        list.insert(it, st);
+      }
+    });
+    bench::do_not_optimize(list.size());
+  }
+  bench::do_not_optimize(found);
+}
+
+} // namespace
+
+int main() {
+  run_size(1000U, true);
+  run_size(10000U, true);
+  run_size(100000U, false);
+  return 0;
+}
@@ -0,0 +1,237 @@
+#include "intrusive_rb_tree.h"
+#include <deque>
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+struct ST {
+  struct NodeTraits : ::estd::IntrusiveListOffsetTraits<ST, NodeTraits> {
+    static constexpr ::estd::size_t offset() noexcept { return offsetof(ST, node_); }
+  };
+  ST() : node_{}, value_{0} {}
+  explicit ST(int v) : node_{}, value_{v} {}
+  ::estd::IntrusiveRbTreeNode<ST, NodeTraits> node_;
+  int value_;
+};
+
+struct STLess {
+  bool operator()(ST const &lhs, ST const &rhs) const noexcept { return lhs.value_ < rhs.value_; }
+  bool operator()(ST const &lhs, int rhs) const noexcept { return lhs.value_ < rhs; }
+  bool operator()(int lhs, ST const &rhs) const noexcept { return lhs < rhs.value_; }
+};
+
+using STNode = ::estd::IntrusiveRbTreeNode<ST, ST::NodeTraits>;
+using STTree = ::estd::IntrusiveRbTree<STNode, STLess>;
+
+std::vector<int> values_of(STTree const &tree) {
+  std::vector<int> values{};
+  for (ST const &st : tree) {
+    values.push_back(st.value_);
+  }
+  return values;
+}
+
+} // namespace
+
+// elements are declared before the tree, the tree unlinks them when it is destroyed
+TEST(IntrusiveRbTree, empty) {
+  STTree tree{};
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.size(), 0U);
+  EXPECT_EQ(tree.begin(), tree.end());
+  EXPECT_EQ(tree.find(1), tree.end());
+  EXPECT_EQ(tree.lower_bound(1), tree.end());
+}
+
+TEST(IntrusiveRbTree, insert_ordered) {
+  std::deque<ST> sts{};
+  STTree tree{};
+  for (int v : {5, 3, 8, 1, 4, 7, 9, 2, 6}) {
+    sts.emplace_back(v);
+  }
+  for (ST &st : sts) {
+    EXPECT_FALSE(st.node_.is_linked());
+    auto it = tree.insert(st);
+    EXPECT_EQ(&*it, &st);
+    EXPECT_TRUE(st.node_.is_linked());
+  }
+  EXPECT_EQ(tree.size(), 9U);
+  EXPECT_EQ(values_of(tree), (std::vector<int>{1, 2, 3, 4, 5, 6, 7, 8, 9}));
+  EXPECT_EQ(tree.front().value_, 1);
+  EXPECT_EQ(tree.back().value_, 9);
+}
+
+TEST(IntrusiveRbTree, reverse_iterate) {
+  std::deque<ST> sts{};
+  STTree tree{};
+  for (int v : {2, 1, 3}) {
+    sts.emplace_back(v);
+  }
+  for (ST &st : sts) {
+    tree.insert(st);
+  }
+  auto it = tree.end();
+  EXPECT_EQ((--it)->value_, 3);
+  EXPECT_EQ((--it)->value_, 2);
+  EXPECT_EQ((--it)->value_, 1);
+  EXPECT_EQ(it, tree.begin());
+}
+
+TEST(IntrusiveRbTree, equivalent_keep_insertion_order) {
+  ST a{1};
+  ST b{1};
+  ST c{1};
+  STTree tree{};
+  tree.insert(a);
+  tree.insert(b);
+  tree.insert(c);
+  auto it = tree.begin();
+  EXPECT_EQ(&*it++, &a);
+  EXPECT_EQ(&*it++, &b);
+  EXPECT_EQ(&*it++, &c);
+  EXPECT_EQ(it, tree.end());
+  EXPECT_EQ(&*tree.find(1), &a);
+}
+
+TEST(IntrusiveRbTree, insert_unique) {
+  ST a{2};
+  ST b{2};
+  ST c{1};
+  ST d{3};
+  STTree tree{};
+  EXPECT_TRUE(tree.insert_unique(a));
+  EXPECT_FALSE(tree.insert_unique(b));
+  EXPECT_FALSE(b.node_.is_linked());
+  EXPECT_TRUE(tree.insert_unique(c));
+  EXPECT_TRUE(tree.insert_unique(d));
+  EXPECT_EQ(values_of(tree), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(IntrusiveRbTree, bounds) {
+  std::deque<ST> sts{};
+  STTree tree{};
+  for (int v : {10, 20, 20, 30}) {
+    sts.emplace_back(v);
+  }
+  for (ST &st : sts) {
+    tree.insert(st);
+  }
+  EXPECT_EQ(tree.lower_bound(5)->value_, 10);
+  EXPECT_EQ(&*tree.lower_bound(20), &sts[1]);
+  EXPECT_EQ(tree.upper_bound(20)->value_, 30);
+  EXPECT_EQ(tree.lower_bound(31), tree.end());
+  EXPECT_EQ(tree.upper_bound(30), tree.end());
+  EXPECT_EQ(tree.find(25), tree.end());
+  EXPECT_EQ(tree.find(30)->value_, 30);
+
+  STTree const &const_tree = tree;
+  EXPECT_EQ(const_tree.lower_bound(15)->value_, 20);
+  EXPECT_EQ(const_tree.find(10)->value_, 10);
+}
+
+TEST(IntrusiveRbTree, erase) {
+  std::deque<ST> sts{};
+  STTree tree{};
+  for (int v : {1, 2, 3, 4}) {
+    sts.emplace_back(v);
+  }
+  for (ST &st : sts) {
+    tree.insert(st);
+  }
+  auto it = tree.erase(tree.find(2));
+  EXPECT_EQ(it->value_, 3);
+  EXPECT_FALSE(sts[1].node_.is_linked());
+  tree.erase(sts[0]);
+  EXPECT_EQ(tree.front().value_, 3);
+  tree.pop_front();
+  EXPECT_EQ(values_of(tree), (std::vector<int>{4}));
+  EXPECT_EQ(tree.back().value_, 4);
+  tree.pop_front();
+  EXPECT_TRUE(tree.empty());
+  EXPECT_EQ(tree.begin(), tree.end());
+}
+
+TEST(IntrusiveRbTree, unlink_by_node) {
+  std::deque<ST> sts{};
+  STTree tree{};
+  for (int v : {1, 2, 3, 4, 5}) {
+    sts.emplace_back(v);
+  }
+  for (ST &st : sts) {
+    tree.insert(st);
+  }
+  sts[4].node_.unlink();
+  sts[0].node_.unlink();
+  sts[2].node_.unlink();
+  EXPECT_FALSE(sts[2].node_.is_linked());
+  sts[2].node_.unlink();
+  EXPECT_EQ(tree.size(), 2U);
+  EXPECT_EQ(values_of(tree), (std::vector<int>{2, 4}));
+  EXPECT_EQ(tree.front().value_, 2);
+  EXPECT_EQ(tree.back().value_, 4);
+}
+
+TEST(IntrusiveRbTree, clear_and_destroy_unlink) {
+  std::deque<ST> sts{};
+  for (int v = 0; v < 100; ++v) {
+    sts.emplace_back(v);
+  }
+  {
+    STTree tree{};
+    for (ST &st : sts) {
+      tree.insert(st);
+    }
+    tree.clear();
+    EXPECT_TRUE(tree.empty());
+    for (ST const &st : sts) {
+      EXPECT_FALSE(st.node_.is_linked());
+    }
+    for (ST &st : sts) {
+      tree.insert(st);
+    }
+  }
+  for (ST const &st : sts) {
+    EXPECT_FALSE(st.node_.is_linked());
+  }
+}
+
+TEST(IntrusiveRbTree, random_compare_with_multiset) {
+  std::mt19937 random{7U};
+  std::vector<ST> sts(2000U);
+  for (ST &st : sts) {
+    st.value_ = static_cast<int>(random() % 500U);
+  }
+  STTree tree{};
+  std::multiset<int> expected{};
+  for (int round = 0; round < 20000; ++round) {
+    ST &st = sts[random() % sts.size()];
+    if (st.node_.is_linked()) {
+      if (round % 2 == 0) {
+        tree.erase(st);
+      } else {
+        st.node_.unlink();
+      }
+      expected.erase(expected.find(st.value_));
+    } else {
+      tree.insert(st);
+      expected.insert(st.value_);
+    }
+    if (round % 1000 == 0) {
+      ASSERT_EQ(values_of(tree), std::vector<int>(expected.begin(), expected.end()));
+      if (!expected.empty()) {
+        EXPECT_EQ(tree.front().value_, *expected.begin());
+        EXPECT_EQ(tree.back().value_, *expected.rbegin());
+      }
+      int const key = static_cast<int>(random() % 500U);
+      auto lower = expected.lower_bound(key);
+      EXPECT_EQ(tree.lower_bound(key) == tree.end(), lower == expected.end());
+      if (lower != expected.end()) {
+        EXPECT_EQ(tree.lower_bound(key)->value_, *lower);
+      }
+    }
+  }
+  EXPECT_EQ(tree.size(), expected.size());
+}
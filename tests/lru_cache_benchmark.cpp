@@ -0,0 +1,102 @@
+#include "benchmark.h"
+#include "lru_cache.h"
+#include <cmath>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kCapacity = 1024U;
+constexpr std::size_t kKeySpace = 65536U;
+constexpr std::size_t kRequestCount = 1000000U;
+
+// keys drawn from a Zipf distribution with exponent s over [0, kKeySpace)
+std::vector<unsigned> zipf_requests(double s) {
+  std::vector<double> cdf(kKeySpace);
+  double sum = 0.0;
+  for (std::size_t i = 0U; i < kKeySpace; ++i) {
+    sum += 1.0 / std::pow(static_cast<double>(i + 1U), s);
+    cdf[i] = sum;
+  }
+  std::mt19937 random{1U};
+  std::uniform_real_distribution<double> uniform{0.0, sum};
+  std::vector<unsigned> requests(kRequestCount);
+  for (unsigned &request : requests) {
+    double const point = uniform(random);
+    std::size_t low = 0U;
+    std::size_t high = kKeySpace - 1U;
+    while (low < high) {
+      std::size_t const mid = (low + high) / 2U;
+      if (cdf[mid] < point) {
+        low = mid + 1U;
+      } else {
+        high = mid;
+      }
+    }
+    // scatter ranks so that hot keys are not neighbours
+    request = static_cast<unsigned>((low * 2654435761U) % kKeySpace);
+  }
+  return requests;
+}
+
+// reference implementation with heap allocated nodes
+class StdLruCache {
+public:
+  unsigned *find(unsigned key) {
+    auto const it = index_.find(key);
+    if (it == index_.end()) {
+      return nullptr;
+    }
+    order_.splice(order_.begin(), order_, it->second);
+    return &it->second->second;
+  }
+  void put(unsigned key, unsigned value) {
+    if (order_.size() == kCapacity) {
+      index_.erase(order_.back().first);
+      order_.pop_back();
+    }
+    order_.emplace_front(key, value);
+    index_[key] = order_.begin();
+  }
+
+private:
+  std::list<std::pair<unsigned, unsigned>> order_{};
+  std::unordered_map<unsigned, std::list<std::pair<unsigned, unsigned>>::iterator> index_{};
+};
+
+void run_workload(char const *estd_name, char const *std_name, std::vector<unsigned> const &requests) {
+  static ::estd::LruCache<unsigned, unsigned, kCapacity, ::estd::hash<unsigned>, ::estd::equal_to, true> cache{};
+  cache.clear();
+  cache.reset_statistics();
+  bench::run(estd_name, kRequestCount, [&requests]() {
+    for (unsigned const key : requests) {
+      if (cache.find(key) == nullptr) {
+        cache.put(key, key);
+      }
+    }
+  });
+  std::printf("  hit ratio %.3f, evictions %zu\n",
+              static_cast<double>(cache.hit_count()) / static_cast<double>(kRequestCount), cache.eviction_count());
+
+  StdLruCache std_cache{};
+  bench::run(std_name, kRequestCount, [&requests, &std_cache]() {
+    for (unsigned const key : requests) {
+      if (std_cache.find(key) == nullptr) {
+        std_cache.put(key, key);
+      }
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  std::vector<unsigned> const requests_099 = zipf_requests(0.99);
+  run_workload("LruCache zipf 0.99", "std::list+unordered_map zipf 0.99", requests_099);
+  std::vector<unsigned> const requests_120 = zipf_requests(1.2);
+  run_workload("LruCache zipf 1.2", "std::list+unordered_map zipf 1.2", requests_120);
+  return 0;
+}
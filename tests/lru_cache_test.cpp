@@ -0,0 +1,135 @@
+#include "lru_cache.h"
+#include <gtest/gtest.h>
+#include <list>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Cache = ::estd::LruCache<int, int, 4U, ::estd::hash<int>, ::estd::equal_to, true>;
+
+std::vector<int> keys_of(Cache &cache) {
+  std::vector<int> keys{};
+  cache.for_each([&keys](int key, int) { keys.push_back(key); });
+  return keys;
+}
+
+} // namespace
+
+TEST(LruCache, empty) {
+  Cache cache{};
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.size(), 0U);
+  EXPECT_EQ(Cache::capacity(), 4U);
+  EXPECT_EQ(cache.find(1), nullptr);
+  EXPECT_EQ(cache.miss_count(), 1U);
+}
+
+TEST(LruCache, put_and_find) {
+  Cache cache{};
+  EXPECT_EQ(cache.put(1, 10), 10);
+  cache.put(2, 20);
+  ASSERT_NE(cache.find(1), nullptr);
+  EXPECT_EQ(*cache.find(1), 10);
+  EXPECT_EQ(*cache.find(2), 20);
+  EXPECT_EQ(cache.find(3), nullptr);
+  EXPECT_EQ(cache.hit_count(), 3U);
+  EXPECT_EQ(cache.miss_count(), 1U);
+
+  cache.put(1, 11);
+  EXPECT_EQ(cache.size(), 2U);
+  EXPECT_EQ(*cache.peek(1), 11);
+  EXPECT_EQ(keys_of(cache), (std::vector<int>{1, 2}));
+}
+
+TEST(LruCache, evict_least_recently_used) {
+  Cache cache{};
+  for (int key = 1; key <= 4; ++key) {
+    cache.put(key, key * 10);
+  }
+  EXPECT_EQ(keys_of(cache), (std::vector<int>{4, 3, 2, 1}));
+  cache.find(1);
+  cache.put(5, 50);
+  EXPECT_EQ(cache.eviction_count(), 1U);
+  EXPECT_FALSE(cache.contains(2));
+  EXPECT_EQ(keys_of(cache), (std::vector<int>{5, 1, 4, 3}));
+
+  // peek does not refresh recency
+  cache.peek(3);
+  cache.put(6, 60);
+  EXPECT_FALSE(cache.contains(3));
+  EXPECT_EQ(cache.size(), 4U);
+}
+
+TEST(LruCache, erase_and_clear) {
+  Cache cache{};
+  for (int key = 1; key <= 4; ++key) {
+    cache.put(key, key);
+  }
+  EXPECT_TRUE(cache.erase(2));
+  EXPECT_FALSE(cache.erase(2));
+  EXPECT_EQ(cache.size(), 3U);
+  cache.put(5, 5);
+  EXPECT_EQ(cache.eviction_count(), 0U);
+  EXPECT_EQ(keys_of(cache), (std::vector<int>{5, 4, 3, 1}));
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.find(5), nullptr);
+  for (int key = 1; key <= 4; ++key) {
+    cache.put(key, key);
+  }
+  EXPECT_EQ(cache.eviction_count(), 0U);
+  cache.reset_statistics();
+  EXPECT_EQ(cache.miss_count(), 0U);
+}
+
+TEST(LruCache, string_key) {
+  ::estd::LruCache<std::string, int, 2U, std::hash<std::string>> cache{};
+  cache.put("a", 1);
+  cache.put("b", 2);
+  cache.put("c", 3);
+  EXPECT_EQ(cache.find("a"), nullptr);
+  EXPECT_EQ(*cache.find("b"), 2);
+}
+
+TEST(LruCache, random_compare_with_reference) {
+  constexpr std::size_t kCapacity = 64U;
+  ::estd::LruCache<int, int, kCapacity> cache{};
+  std::list<std::pair<int, int>> order{};
+  std::unordered_map<int, std::list<std::pair<int, int>>::iterator> index{};
+  std::mt19937 random{5U};
+  for (int round = 0; round < 20000; ++round) {
+    int const key = static_cast<int>(random() % 200U);
+    if (random() % 2U == 0U) {
+      auto const it = index.find(key);
+      int *const value = cache.find(key);
+      ASSERT_EQ(value == nullptr, it == index.end());
+      if (value != nullptr) {
+        EXPECT_EQ(*value, it->second->second);
+        order.splice(order.begin(), order, it->second);
+      }
+    } else {
+      cache.put(key, round);
+      auto const it = index.find(key);
+      if (it != index.end()) {
+        order.erase(it->second);
+      } else if (order.size() == kCapacity) {
+        index.erase(order.back().first);
+        order.pop_back();
+      }
+      order.emplace_front(key, round);
+      index[key] = order.begin();
+    }
+  }
+  std::vector<int> expected{};
+  for (auto const &entry : order) {
+    expected.push_back(entry.first);
+  }
+  std::vector<int> actual{};
+  cache.for_each([&actual](int key, int) { actual.push_back(key); });
+  EXPECT_EQ(actual, expected);
+}
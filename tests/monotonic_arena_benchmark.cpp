@@ -0,0 +1,42 @@
+#include "benchmark.h"
+#include "monotonic_arena.h"
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kBurst = 1024U;
+constexpr std::size_t kRound = 1024U;
+
+// typical small allocation sizes of a frame
+std::size_t burst_size(std::size_t i) noexcept { return 16U + (i * 7U) % 112U; }
+
+} // namespace
+
+int main() {
+  std::vector<void *> pointers(kBurst);
+  bench::run("malloc/free burst", kBurst * kRound, [&pointers]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      for (std::size_t i = 0U; i < kBurst; ++i) {
+        pointers[i] = std::malloc(burst_size(i));
+        bench::do_not_optimize(pointers[i]);
+      }
+      for (std::size_t i = 0U; i < kBurst; ++i) {
+        std::free(pointers[i]);
+      }
+    }
+  });
+
+  static ::estd::Array<unsigned char, kBurst * 128U> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  bench::run("MonotonicArena allocate/reset burst", kBurst * kRound, [&arena, &pointers]() {
+    for (std::size_t r = 0U; r < kRound; ++r) {
+      ::estd::MonotonicArena::Scope const scope{arena};
+      for (std::size_t i = 0U; i < kBurst; ++i) {
+        pointers[i] = arena.allocate(burst_size(i), 8U);
+        bench::do_not_optimize(pointers[i]);
+      }
+    }
+  });
+  return 0;
+}
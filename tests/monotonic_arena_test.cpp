@@ -0,0 +1,99 @@
+#include "monotonic_arena.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+TEST(MonotonicArena, aligned_allocate) {
+  ::estd::Array<unsigned char, 256> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  EXPECT_EQ(arena.capacity(), 256U);
+  void *const a = arena.allocate(1U, 1U);
+  void *const b = arena.allocate(8U, 8U);
+  void *const c = arena.allocate(4U, 32U);
+  EXPECT_NE(a, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(b) % 8U, 0U);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(c) % 32U, 0U);
+  EXPECT_LT(a, b);
+  EXPECT_LT(b, c);
+  EXPECT_LE(arena.used(), 256U);
+}
+
+TEST(MonotonicArena, exhausted) {
+  alignas(16) unsigned char buffer[64];
+  ::estd::MonotonicArena arena{buffer, sizeof(buffer)};
+  EXPECT_NE(arena.allocate(48U, 16U), nullptr);
+  EXPECT_EQ(arena.allocate(32U, 16U), nullptr);
+  EXPECT_NE(arena.allocate(16U, 16U), nullptr);
+  EXPECT_EQ(arena.remaining(), 0U);
+  EXPECT_EQ(arena.allocate(1U, 1U), nullptr);
+}
+
+TEST(MonotonicArena, mark_and_rewind) {
+  ::estd::Array<unsigned char, 128> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  arena.allocate(8U, 8U);
+  auto const marker = arena.mark();
+  size_t const used = arena.used();
+  arena.allocate(16U, 8U);
+  arena.allocate(16U, 8U);
+  arena.rewind(marker);
+  EXPECT_EQ(arena.used(), used);
+  {
+    ::estd::MonotonicArena::Scope const scope{arena};
+    arena.allocate(32U, 8U);
+    EXPECT_GT(arena.used(), used);
+  }
+  EXPECT_EQ(arena.used(), used);
+  arena.reset();
+  EXPECT_EQ(arena.used(), 0U);
+}
+
+TEST(MonotonicArena, stack_deallocate) {
+  ::estd::Array<unsigned char, 128> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  void *const a = arena.allocate(16U, 8U);
+  void *const b = arena.allocate(16U, 8U);
+  size_t const used = arena.used();
+  // not the most recent allocation, kept
+  arena.deallocate(a, 16U);
+  EXPECT_EQ(arena.used(), used);
+  arena.deallocate(b, 16U);
+  EXPECT_EQ(arena.used(), used - 16U);
+}
+
+TEST(MonotonicArena, create) {
+  struct Point {
+    Point(int x, int y) : x_{x}, y_{y} {}
+    int x_;
+    int y_;
+  };
+  ::estd::Array<unsigned char, 64> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  Point *const p = arena.create<Point>(1, 2);
+  ASSERT_NE(p, nullptr);
+  EXPECT_EQ(p->x_, 1);
+  EXPECT_EQ(p->y_, 2);
+}
+
+TEST(ArenaAllocator, vector) {
+  ::estd::Array<unsigned char, 1024> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  ::estd::ArenaAllocator<int> const allocator{arena};
+  std::vector<int, ::estd::ArenaAllocator<int>> vector{allocator};
+  vector.reserve(16U);
+  for (int i = 0; i < 16; ++i) {
+    vector.push_back(i);
+  }
+  EXPECT_EQ(vector[15], 15);
+  EXPECT_GE(arena.used(), 16U * sizeof(int));
+  EXPECT_TRUE(allocator == ::estd::ArenaAllocator<double>{arena});
+}
+
+TEST(ArenaAllocatorDeathTest, size_overflow) {
+  ::estd::Array<unsigned char, 64> buffer{};
+  ::estd::MonotonicArena arena{buffer};
+  ::estd::ArenaAllocator<std::uint64_t> allocator{arena};
+  // n * sizeof(std::uint64_t) wraps to 8 bytes, which would fit in the buffer
+  std::size_t const n = static_cast<std::size_t>(-1) / sizeof(std::uint64_t) + 2U;
+  ASSERT_DEATH(allocator.allocate(n), "");
+}
@@ -0,0 +1,73 @@
+#include "benchmark.h"
+#include "mpmc_queue.h"
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kOpsPerThread = 1U << 18U;
+
+class MutexQueue {
+public:
+  bool push(std::uint64_t value) {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    if (queue_.size() >= 1024U) {
+      return false;
+    }
+    queue_.push_back(value);
+    return true;
+  }
+  bool pop(std::uint64_t &value) {
+    std::lock_guard<std::mutex> const lock{mutex_};
+    if (queue_.empty()) {
+      return false;
+    }
+    value = queue_.front();
+    queue_.pop_front();
+    return true;
+  }
+
+private:
+  std::mutex mutex_{};
+  std::deque<std::uint64_t> queue_{};
+};
+
+// every thread pushes then pops, so producers and consumers contend on both ends
+template <class Queue> void run_threads(char const *prefix, unsigned thread_count) {
+  Queue queue{};
+  char name[64];
+  std::snprintf(name, sizeof(name), "%s threads=%u", prefix, thread_count);
+  bench::run(name, kOpsPerThread * thread_count * 2U, [&queue, thread_count]() {
+    std::vector<std::thread> threads{};
+    for (unsigned t = 0U; t < thread_count; ++t) {
+      threads.emplace_back([&queue, t]() {
+        std::uint64_t value = 0U;
+        for (std::size_t i = 0U; i < kOpsPerThread; ++i) {
+          while (!queue.push(i + t)) {
+            std::this_thread::yield();
+          }
+          while (!queue.pop(value)) {
+            std::this_thread::yield();
+          }
+          bench::do_not_optimize(value);
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  for (unsigned thread_count = 1U; thread_count <= 16U; thread_count *= 2U) {
+    run_threads<::estd::MpmcQueue<std::uint64_t, 1024>>("MpmcQueue", thread_count);
+    run_threads<MutexQueue>("mutex + std::deque", thread_count);
+  }
+  return 0;
+}
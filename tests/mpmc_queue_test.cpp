@@ -0,0 +1,84 @@
+#include "mpmc_queue.h"
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST(MpmcQueue, push_and_pop) {
+  ::estd::MpmcQueue<int, 4> queue{};
+  EXPECT_TRUE(queue.empty());
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.push(i));
+  }
+  EXPECT_FALSE(queue.push(4));
+  EXPECT_EQ(queue.size(), 4U);
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(queue.pop(value));
+}
+
+TEST(MpmcQueue, non_trivial_element) {
+  std::shared_ptr<int> const counter = std::make_shared<int>(0);
+  {
+    ::estd::MpmcQueue<std::shared_ptr<int>, 8> queue{};
+    EXPECT_TRUE(queue.push(counter));
+    EXPECT_TRUE(queue.emplace(counter));
+    EXPECT_EQ(counter.use_count(), 3);
+    std::shared_ptr<int> value{};
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, counter);
+    value.reset();
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  // remaining element is destroyed with queue
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(MpmcQueue, stress) {
+  constexpr unsigned kProducer = 4U;
+  constexpr unsigned kConsumer = 4U;
+  constexpr std::uint32_t kPerProducer = 20000U;
+  ::estd::MpmcQueue<std::uint32_t, 64> queue{};
+  std::vector<std::atomic<std::uint32_t>> received(kProducer * kPerProducer);
+  for (auto &r : received) {
+    r.store(0U);
+  }
+  std::atomic<std::uint32_t> consumed{0U};
+
+  std::vector<std::thread> threads{};
+  for (unsigned p = 0U; p < kProducer; ++p) {
+    threads.emplace_back([&queue, p]() {
+      for (std::uint32_t i = 0U; i < kPerProducer; ++i) {
+        while (!queue.push(p * kPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (unsigned c = 0U; c < kConsumer; ++c) {
+    threads.emplace_back([&queue, &received, &consumed]() {
+      std::uint32_t value = 0U;
+      while (consumed.load() < kProducer * kPerProducer) {
+        if (queue.pop(value)) {
+          received[value].fetch_add(1U);
+          consumed.fetch_add(1U);
+        } else {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (std::thread &t : threads) {
+    t.join();
+  }
+  EXPECT_TRUE(queue.empty());
+  for (auto const &r : received) {
+    ASSERT_EQ(r.load(), 1U);
+  }
+}
@@ -0,0 +1,65 @@
+#include "object_pool.h"
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+TEST(ObjectPool, allocate_and_deallocate) {
+  ::estd::ObjectPool<int, 4> pool{};
+  EXPECT_EQ(pool.capacity(), 4U);
+  EXPECT_EQ(pool.available(), 4U);
+  std::set<int *> allocated{};
+  for (int i = 0; i < 4; ++i) {
+    int *const p = pool.allocate();
+    ASSERT_NE(p, nullptr);
+    *p = i;
+    allocated.insert(p);
+  }
+  EXPECT_EQ(allocated.size(), 4U);
+  EXPECT_TRUE(pool.empty());
+  EXPECT_EQ(pool.in_use(), 4U);
+  EXPECT_EQ(pool.allocate(), nullptr);
+
+  int *const released = *allocated.begin();
+  pool.deallocate(released);
+  EXPECT_EQ(pool.available(), 1U);
+  EXPECT_EQ(pool.allocate(), released);
+}
+
+TEST(ObjectPool, create_and_destroy) {
+  ::estd::ObjectPool<std::string, 2> pool{};
+  std::string *const a = pool.create(3U, 'a');
+  std::string *const b = pool.create("b");
+  EXPECT_EQ(*a, "aaa");
+  EXPECT_EQ(*b, "b");
+  EXPECT_EQ(pool.create("c"), nullptr);
+  pool.destroy(a);
+  std::string *const c = pool.create("c");
+  EXPECT_EQ(c, a);
+  EXPECT_EQ(*c, "c");
+  pool.destroy(b);
+  pool.destroy(c);
+  EXPECT_EQ(pool.in_use(), 0U);
+}
+
+TEST(ObjectPool, statistics) {
+  ::estd::ObjectPool<double, 3, true> pool{};
+  double *const a = pool.allocate();
+  double *const b = pool.allocate();
+  pool.deallocate(a);
+  double *const c = pool.allocate();
+  double *const d = pool.allocate();
+  EXPECT_EQ(pool.allocate(), nullptr);
+  EXPECT_EQ(pool.allocate(), nullptr);
+  EXPECT_EQ(pool.high_water_mark(), 3U);
+  EXPECT_EQ(pool.failure_count(), 2U);
+  pool.deallocate(b);
+  pool.deallocate(c);
+  pool.deallocate(d);
+  EXPECT_EQ(pool.high_water_mark(), 3U);
+}
+
+TEST(ObjectPoolDeathTest, deallocate_foreign_pointer) {
+  ::estd::ObjectPool<int, 2> pool{};
+  int foreign = 0;
+  ASSERT_DEATH(pool.deallocate(&foreign), "");
+}
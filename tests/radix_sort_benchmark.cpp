@@ -0,0 +1,78 @@
+#include "algorithm.h"
+#include "benchmark.h"
+#include "radix_sort.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+namespace {
+
+struct Sample {
+  std::uint64_t timestamp;
+  std::uint32_t id;
+};
+
+template <class T, std::size_t N, class Fill, class Less, class Key> void run_size(char const *type_name, Fill fill,
+                                                                                   Less less, Key key) {
+  static ::estd::Array<T, N> input{};
+  static ::estd::Array<T, N> work{};
+  static ::estd::Array<T, N> scratch{};
+  std::mt19937_64 random{N};
+  for (T &value : input) {
+    fill(value, random);
+  }
+  char name[96];
+
+  std::snprintf(name, sizeof(name), "std::sort %s n=%zu", type_name, N);
+  bench::run(name, N, [&less]() {
+    work = input;
+    std::sort(work.begin(), work.end(), less);
+    bench::do_not_optimize(work.data());
+  });
+  std::snprintf(name, sizeof(name), "estd::sort %s n=%zu", type_name, N);
+  bench::run(name, N, [&less]() {
+    work = input;
+    ::estd::sort(work.begin(), work.end(), less);
+    bench::do_not_optimize(work.data());
+  });
+  std::snprintf(name, sizeof(name), "estd::radix_sort %s n=%zu", type_name, N);
+  bench::run(name, N, [&key]() {
+    work = input;
+    ::estd::radix_sort(work, scratch, key);
+    bench::do_not_optimize(work.data());
+  });
+}
+
+template <std::size_t N> void run_all() {
+  auto const identity = [](auto const &value) { return value; };
+  run_size<std::uint32_t, N>(
+      "uint32_t", [](std::uint32_t &value, std::mt19937_64 &random) { value = static_cast<std::uint32_t>(random()); },
+      ::estd::less{}, identity);
+  run_size<float, N>(
+      "float",
+      [](float &value, std::mt19937_64 &random) {
+        value = std::uniform_real_distribution<float>{-1e6F, 1e6F}(random);
+      },
+      ::estd::less{}, identity);
+  // timestamps of one hour in microseconds, upper bytes are shared and skipped
+  run_size<Sample, N>(
+      "Sample",
+      [](Sample &value, std::mt19937_64 &random) {
+        value.timestamp = 1700000000000000ULL + random() % 3600000000ULL;
+        value.id = static_cast<std::uint32_t>(random());
+      },
+      [](Sample const &lhs, Sample const &rhs) { return lhs.timestamp < rhs.timestamp; },
+      [](Sample const &value) { return value.timestamp; });
+}
+
+} // namespace
+
+int main() {
+  run_all<1000U>();
+  run_all<10000U>();
+  run_all<100000U>();
+  run_all<1000000U>();
+  return 0;
+}
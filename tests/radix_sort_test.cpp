@@ -0,0 +1,112 @@
+#include "radix_sort.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+template <class T> std::vector<T> make_random(std::size_t size, std::uint32_t seed) {
+  std::mt19937_64 random{seed};
+  std::vector<T> values(size);
+  for (T &value : values) {
+    value = static_cast<T>(random());
+  }
+  return values;
+}
+
+template <class T> void expect_sorted_like_std(std::vector<T> values) {
+  std::vector<T> expected = values;
+  std::sort(expected.begin(), expected.end());
+  std::vector<T> scratch(values.size() + 1U);
+  ::estd::radix_sort(values.data(), values.data() + values.size(), scratch.data());
+  EXPECT_EQ(values, expected);
+}
+
+struct Sample {
+  std::uint64_t timestamp;
+  std::uint32_t id;
+};
+
+} // namespace
+
+TEST(RadixSort, unsigned_keys) {
+  expect_sorted_like_std(make_random<std::uint8_t>(1000U, 1U));
+  expect_sorted_like_std(make_random<std::uint16_t>(1000U, 2U));
+  expect_sorted_like_std(make_random<std::uint32_t>(10000U, 3U));
+  expect_sorted_like_std(make_random<std::uint64_t>(10000U, 4U));
+}
+
+TEST(RadixSort, signed_keys) {
+  expect_sorted_like_std(make_random<std::int8_t>(1000U, 5U));
+  expect_sorted_like_std(make_random<std::int16_t>(1000U, 6U));
+  expect_sorted_like_std(make_random<std::int32_t>(10000U, 7U));
+  expect_sorted_like_std(make_random<std::int64_t>(10000U, 8U));
+  expect_sorted_like_std(std::vector<int>{0, -1, std::numeric_limits<int>::min(), 1, std::numeric_limits<int>::max()});
+}
+
+TEST(RadixSort, float_keys) {
+  std::mt19937 random{9U};
+  std::uniform_real_distribution<float> distribution{-1000.0F, 1000.0F};
+  std::vector<float> floats(10000U);
+  for (float &value : floats) {
+    value = distribution(random);
+  }
+  floats.push_back(std::numeric_limits<float>::infinity());
+  floats.push_back(-std::numeric_limits<float>::infinity());
+  floats.push_back(std::numeric_limits<float>::denorm_min());
+  floats.push_back(-std::numeric_limits<float>::max());
+  floats.push_back(0.0F);
+  expect_sorted_like_std(floats);
+
+  std::vector<double> doubles(10000U);
+  for (double &value : doubles) {
+    value = static_cast<double>(distribution(random)) * 1e100;
+  }
+  expect_sorted_like_std(doubles);
+}
+
+TEST(RadixSort, negative_zero_before_zero) {
+  ::estd::Array<float, 3> data{0.0F, -0.0F, -1.0F};
+  ::estd::Array<float, 3> scratch{};
+  ::estd::radix_sort(data, scratch);
+  EXPECT_EQ(data[0], -1.0F);
+  EXPECT_TRUE(std::signbit(data[1]));
+  EXPECT_FALSE(std::signbit(data[2]));
+}
+
+TEST(RadixSort, empty_and_single) {
+  expect_sorted_like_std(std::vector<std::uint32_t>{});
+  expect_sorted_like_std(std::vector<std::uint32_t>{42U});
+}
+
+TEST(RadixSort, skip_uniform_bytes) {
+  // only the lowest byte differs, one pass leaves result in scratch and it is copied back
+  std::vector<std::uint32_t> values = make_random<std::uint32_t>(1000U, 10U);
+  for (std::uint32_t &value : values) {
+    value = 0xABCD0000U | (value & 0xFFU);
+  }
+  expect_sorted_like_std(values);
+  // all keys are equal
+  expect_sorted_like_std(std::vector<std::uint64_t>(100U, 7U));
+}
+
+TEST(RadixSort, key_extractor_is_stable) {
+  ::estd::Array<Sample, 1000> data{};
+  ::estd::Array<Sample, 1000> scratch{};
+  std::mt19937 random{11U};
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    data[i].timestamp = random() % 50U;
+    data[i].id = static_cast<std::uint32_t>(i);
+  }
+  ::estd::radix_sort(data, scratch, [](Sample const &sample) { return sample.timestamp; });
+  for (std::size_t i = 1; i < data.size(); ++i) {
+    ASSERT_LE(data[i - 1].timestamp, data[i].timestamp);
+    if (data[i - 1].timestamp == data[i].timestamp) {
+      EXPECT_LT(data[i - 1].id, data[i].id);
+    }
+  }
+}
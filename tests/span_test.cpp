@@ -0,0 +1,100 @@
+#include "span.h"
+#include "static_string.h"
+#include "static_vector.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <type_traits>
+
+namespace {
+
+// one function serves every size, no template on N
+int sum(::estd::Span<int const> values) { return std::accumulate(values.begin(), values.end(), 0); }
+
+void fill_iota(::estd::Span<int> values, int start) { std::iota(values.begin(), values.end(), start); }
+
+constexpr int kTable[] = {1, 2, 3, 4, 5};
+
+} // namespace
+
+TEST(Span, static_extent_stores_only_pointer) {
+  static_assert(sizeof(::estd::Span<int, 4U>) == sizeof(int *), "");
+  static_assert(sizeof(::estd::Span<int>) == sizeof(int *) + sizeof(std::size_t), "");
+  static_assert(::estd::Span<int, 4U>::extent == 4U, "");
+  static_assert(::estd::Span<int>::extent == ::estd::dynamic_extent, "");
+  static_assert(std::is_trivially_copyable<::estd::Span<int, 4U>>::value, "");
+}
+
+TEST(Span, converts_from_array_c_array_and_containers) {
+  ::estd::Array<int, 4U> array{1, 2, 3, 4};
+  int c_array[3] = {5, 6, 7};
+  ::estd::StaticVector<int, 8U> vector{8, 9};
+  EXPECT_EQ(sum(array), 10);
+  EXPECT_EQ(sum(c_array), 18);
+  EXPECT_EQ(sum(vector), 17);
+  ::estd::StaticVector<int, 8U> const &const_vector = vector;
+  EXPECT_EQ(sum(const_vector), 17);
+
+  fill_iota(array, 10);
+  EXPECT_EQ(array[3], 13);
+  ::estd::Span<int, 4U> const fixed{array};
+  EXPECT_EQ(fixed.data(), array.data());
+  ::estd::Span<int const, 4U> const read_only{fixed};
+  EXPECT_EQ(read_only.back(), 13);
+
+  ::estd::StaticString<8U> text{"abc"};
+  ::estd::Span<char> chars{text};
+  chars[0] = 'x';
+  EXPECT_EQ(text, "xbc");
+
+  static_assert(!std::is_convertible<::estd::Array<int, 4U> &, ::estd::Span<int, 3U>>::value, "");
+  static_assert(!std::is_convertible<::estd::Array<int, 4U> const &, ::estd::Span<int>>::value, "");
+  static_assert(!std::is_convertible<::estd::Span<int const>, ::estd::Span<int>>::value, "");
+  static_assert(!std::is_convertible<::estd::StaticVector<int, 4U> &, ::estd::Span<int, 4U>>::value, "");
+  static_assert(!std::is_convertible<::estd::Array<long, 4U> &, ::estd::Span<int>>::value, "");
+}
+
+TEST(Span, slicing_does_not_copy) {
+  ::estd::Array<int, 8U> array{0, 1, 2, 3, 4, 5, 6, 7};
+  ::estd::Span<int, 8U> const span = ::estd::make_span(array);
+
+  auto const head = span.first<3U>();
+  static_assert(std::is_same<decltype(head), ::estd::Span<int, 3U> const>::value, "");
+  EXPECT_EQ(head.data(), array.data());
+  auto const tail = span.last<2U>();
+  EXPECT_EQ(tail.data(), array.data() + 6);
+  auto const middle = span.subspan<2U, 3U>();
+  static_assert(decltype(middle)::extent == 3U, "");
+  EXPECT_EQ(middle[0], 2);
+  auto const rest = span.subspan<5U>();
+  static_assert(decltype(rest)::extent == 3U, "");
+  EXPECT_EQ(rest.front(), 5);
+
+  ::estd::Span<int> const dynamic{array.data(), array.size()};
+  auto const rest_dynamic = dynamic.subspan<5U>();
+  static_assert(decltype(rest_dynamic)::extent == ::estd::dynamic_extent, "");
+  EXPECT_EQ(rest_dynamic.size(), 3U);
+  EXPECT_EQ(dynamic.first(0U).size(), 0U);
+  EXPECT_TRUE(dynamic.first(0U).empty());
+  EXPECT_EQ(dynamic.last(3U).data(), array.data() + 5);
+  EXPECT_EQ(dynamic.subspan(1U, 2U).back(), 2);
+  EXPECT_EQ(dynamic.subspan(8U).size(), 0U);
+
+  dynamic.subspan(4U)[0] = 40;
+  EXPECT_EQ(array[4], 40);
+  EXPECT_EQ(span.size_bytes(), sizeof(array));
+}
+
+TEST(Span, constexpr_view) {
+  constexpr ::estd::Span<int const, 5U> table{kTable};
+  static_assert(table.size() == 5U && table[4] == 5, "");
+  static_assert(table.subspan<1U, 2U>().back() == 3, "");
+  static_assert(table.last(2U).front() == 4, "");
+  constexpr ::estd::Span<int const> empty{};
+  static_assert(empty.empty() && empty.data() == nullptr, "");
+  int buffer[2] = {1, 2};
+  ::estd::Span<int> const pair{buffer, buffer + 2};
+  EXPECT_EQ(pair.size(), 2U);
+  ::estd::Span<int> const none{buffer, 0};
+  EXPECT_TRUE(none.empty());
+}
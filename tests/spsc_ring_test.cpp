@@ -0,0 +1,138 @@
+#include "spsc_ring.h"
+#include <atomic>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+TEST(SpscRing, push_and_pop) {
+  ::estd::SpscRing<int, 4> ring{};
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(ring.capacity(), 4U);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(ring.push(i));
+  }
+  EXPECT_TRUE(ring.full());
+  EXPECT_FALSE(ring.push(4));
+  int value = -1;
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(ring.pop(value));
+    EXPECT_EQ(value, i);
+  }
+  EXPECT_FALSE(ring.pop(value));
+  EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRing, push_n_and_pop_n_wrap_around) {
+  ::estd::SpscRing<int, 8> ring{};
+  int const first[6] = {0, 1, 2, 3, 4, 5};
+  EXPECT_EQ(ring.push_n(first, 6U), 6U);
+  int out[8] = {};
+  EXPECT_EQ(ring.pop_n(out, 5U), 5U);
+  // head at 6, tail at 5, next push wraps around the end of storage
+  int const second[10] = {6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+  EXPECT_EQ(ring.push_n(second, 10U), 7U);
+  EXPECT_TRUE(ring.full());
+  EXPECT_EQ(ring.pop_n(out, 8U), 8U);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(out[i], i + 5);
+  }
+  EXPECT_EQ(ring.pop_n(out, 8U), 0U);
+}
+
+TEST(SpscRing, peek_and_commit) {
+  ::estd::SpscRing<std::uint8_t, 8> ring{};
+  ::estd::size_t count = 0U;
+  std::uint8_t *write = ring.peek_write(count);
+  EXPECT_EQ(count, 8U);
+  write[0] = 1U;
+  write[1] = 2U;
+  ring.commit_write(2U);
+  EXPECT_EQ(ring.size(), 2U);
+
+  std::uint8_t const *read = ring.peek_read(count);
+  ASSERT_EQ(count, 2U);
+  EXPECT_EQ(read[0], 1U);
+  EXPECT_EQ(read[1], 2U);
+  ring.commit_read(2U);
+  EXPECT_TRUE(ring.empty());
+
+  // region returned by peek stops at the end of storage
+  write = ring.peek_write(count);
+  EXPECT_EQ(count, 6U);
+  ring.commit_write(6U);
+  write = ring.peek_write(count);
+  EXPECT_EQ(count, 2U);
+}
+
+TEST(SpscRing, concurrent) {
+  constexpr std::uint32_t kCount = 100000U;
+  ::estd::SpscRing<std::uint32_t, 64> ring{};
+  std::thread producer{[&ring]() {
+    std::uint32_t next = 0U;
+    std::uint32_t batch[7];
+    while (next < kCount) {
+      std::uint32_t n = 0U;
+      for (; n < 7U && next + n < kCount; ++n) {
+        batch[n] = next + n;
+      }
+      std::uint32_t const pushed = static_cast<std::uint32_t>(ring.push_n(batch, n));
+      if (pushed == 0U) {
+        std::this_thread::yield();
+      }
+      next += pushed;
+    }
+  }};
+  std::vector<std::uint32_t> received{};
+  received.reserve(kCount);
+  std::uint32_t buffer[5];
+  while (received.size() < kCount) {
+    ::estd::size_t const n = ring.pop_n(buffer, 5U);
+    if (n == 0U) {
+      std::this_thread::yield();
+    }
+    received.insert(received.end(), buffer, buffer + n);
+  }
+  producer.join();
+  for (std::uint32_t i = 0U; i < kCount; ++i) {
+    ASSERT_EQ(received[i], i);
+  }
+}
+
+TEST(SpscRing, size_from_monitor_thread) {
+  constexpr std::uint32_t kCount = 100000U;
+  ::estd::SpscRing<std::uint32_t, 8> ring{};
+  std::atomic<bool> done{false};
+  std::atomic<::estd::size_t> max_size{0U};
+  std::thread monitor{[&ring, &done, &max_size]() {
+    while (!done.load()) {
+      ::estd::size_t const size = ring.size();
+      if (size > max_size.load()) {
+        max_size.store(size);
+      }
+      std::this_thread::yield();
+    }
+  }};
+  std::thread producer{[&ring]() {
+    for (std::uint32_t i = 0U; i < kCount;) {
+      if (ring.push(i)) {
+        ++i;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  }};
+  std::uint32_t value = 0U;
+  for (std::uint32_t i = 0U; i < kCount;) {
+    if (ring.pop(value)) {
+      ++i;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  done.store(true);
+  monitor.join();
+  EXPECT_LE(max_size.load(), ring.capacity());
+  EXPECT_TRUE(ring.empty());
+}
@@ -0,0 +1,87 @@
+#include "benchmark.h"
+#include "static_hash_map.h"
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kSlots = 4096U;
+constexpr std::size_t kLookup = 1000000U;
+
+using Map = ::estd::StaticHashMap<std::uint64_t, std::uint32_t, kSlots>;
+
+void run_load(std::size_t size) {
+  static Map map{};
+  map.clear();
+  std::unordered_map<std::uint64_t, std::uint32_t> std_map{};
+  std::mt19937_64 random{size};
+  std::vector<std::uint64_t> keys(size);
+  for (std::size_t i = 0U; i < size; ++i) {
+    keys[i] = random();
+    map.insert(keys[i], static_cast<std::uint32_t>(i));
+    std_map.emplace(keys[i], static_cast<std::uint32_t>(i));
+  }
+  std::vector<std::uint64_t> hits(kLookup);
+  std::vector<std::uint64_t> misses(kLookup);
+  for (std::size_t i = 0U; i < kLookup; ++i) {
+    hits[i] = keys[random() % size];
+    misses[i] = random();
+  }
+  std::printf("load factor %.3f, average probe %.3f, max probe %zu\n", static_cast<double>(map.load_factor()),
+              static_cast<double>(map.average_probe_length()), map.max_probe_length());
+  char name[96];
+
+  std::snprintf(name, sizeof(name), "std::unordered_map hit n=%zu", size);
+  bench::run(name, kLookup, [&std_map, &hits]() {
+    for (std::uint64_t key : hits) {
+      bench::do_not_optimize(std_map.find(key)->second);
+    }
+  });
+  std::snprintf(name, sizeof(name), "StaticHashMap hit n=%zu", size);
+  bench::run(name, kLookup, [&hits]() {
+    for (std::uint64_t key : hits) {
+      bench::do_not_optimize(*map.find(key));
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::unordered_map miss n=%zu", size);
+  bench::run(name, kLookup, [&std_map, &misses]() {
+    for (std::uint64_t key : misses) {
+      bench::do_not_optimize(std_map.find(key) == std_map.end());
+    }
+  });
+  std::snprintf(name, sizeof(name), "StaticHashMap miss n=%zu", size);
+  bench::run(name, kLookup, [&misses]() {
+    for (std::uint64_t key : misses) {
+      bench::do_not_optimize(map.find(key) == nullptr);
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::unordered_map insert/erase n=%zu", size);
+  bench::run(name, size, [&std_map, &keys]() {
+    for (std::uint64_t key : keys) {
+      std_map.erase(key);
+    }
+    for (std::uint64_t key : keys) {
+      std_map.emplace(key, 0U);
+    }
+  });
+  std::snprintf(name, sizeof(name), "StaticHashMap insert/erase n=%zu", size);
+  bench::run(name, size, [&keys]() {
+    for (std::uint64_t key : keys) {
+      map.erase(key);
+    }
+    for (std::uint64_t key : keys) {
+      map.insert(key, 0U);
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_load(kSlots / 2U);
+  run_load(kSlots * 7U / 8U);
+  return 0;
+}
@@ -0,0 +1,98 @@
+#include "static_hash_map.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+namespace {
+
+// all keys collide into one home slot
+struct ConstantHash {
+  std::size_t operator()(int) const noexcept { return 3U; }
+};
+
+} // namespace
+
+TEST(StaticHashMap, insert_find_erase) {
+  ::estd::StaticHashMap<int, std::string, 8> map{};
+  EXPECT_TRUE(map.empty());
+  EXPECT_TRUE(map.insert(1, "one"));
+  EXPECT_FALSE(map.insert(1, "uno"));
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno"));
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_TRUE(map.insert_or_assign(2, "two"));
+  map[3] = "three";
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_TRUE(map.contains(3));
+  EXPECT_EQ(map.find(4), nullptr);
+  EXPECT_EQ(map.erase(2), 1U);
+  EXPECT_EQ(map.erase(2), 0U);
+  EXPECT_EQ(map.find(2), nullptr);
+  EXPECT_EQ(map.size(), 2U);
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  EXPECT_FALSE(map.contains(1));
+}
+
+TEST(StaticHashMap, collisions_and_backward_shift) {
+  ::estd::StaticHashMap<int, int, 8, ConstantHash> map{};
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_TRUE(map.insert(i, i * 10));
+  }
+  EXPECT_EQ(map.max_probe_length(), 7U);
+  EXPECT_FLOAT_EQ(map.load_factor(), 1.0F);
+  EXPECT_FALSE(map.contains(8));
+  EXPECT_EQ(map.erase(0), 1U);
+  EXPECT_EQ(map.erase(5), 1U);
+  EXPECT_EQ(map.max_probe_length(), 5U);
+  for (int i = 0; i < 8; ++i) {
+    if (i == 0 || i == 5) {
+      EXPECT_EQ(map.find(i), nullptr);
+    } else {
+      ASSERT_NE(map.find(i), nullptr);
+      EXPECT_EQ(*map.find(i), i * 10);
+    }
+  }
+}
+
+TEST(StaticHashMap, random_against_unordered_map) {
+  std::mt19937 random{1U};
+  std::unordered_map<std::uint32_t, std::uint32_t> expected{};
+  ::estd::StaticHashMap<std::uint32_t, std::uint32_t, 1024> map{};
+  for (std::uint32_t i = 0; i < 100000U; ++i) {
+    std::uint32_t const key = random() % 2000U;
+    if (random() % 2U == 0U && expected.size() < 900U) {
+      EXPECT_EQ(map.insert(key, i), expected.emplace(key, i).second);
+    } else {
+      EXPECT_EQ(map.erase(key), expected.erase(key));
+    }
+  }
+  ASSERT_EQ(map.size(), expected.size());
+  for (auto const &element : expected) {
+    ASSERT_NE(map.find(element.first), nullptr);
+    EXPECT_EQ(*map.find(element.first), element.second);
+  }
+  std::size_t visited = 0U;
+  map.for_each([&expected, &visited](std::uint32_t const &key, std::uint32_t &value) {
+    EXPECT_EQ(expected.at(key), value);
+    ++visited;
+  });
+  EXPECT_EQ(visited, expected.size());
+  EXPECT_LT(map.average_probe_length(), 4.0F);
+}
+
+TEST(StaticHashMap, statistics_empty) {
+  ::estd::StaticHashMap<int, int, 4> const map{};
+  EXPECT_EQ(map.max_probe_length(), 0U);
+  EXPECT_FLOAT_EQ(map.average_probe_length(), 0.0F);
+  EXPECT_FLOAT_EQ(map.load_factor(), 0.0F);
+}
+
+TEST(StaticHashMapDeathTest, insert_full) {
+  ::estd::StaticHashMap<int, int, 2> map{};
+  map.insert(1, 1);
+  map.insert(2, 2);
+  ASSERT_DEATH(map.insert(3, 3), "");
+}
@@ -0,0 +1,115 @@
+#include "benchmark.h"
+#include "static_hash_map.h"
+#include "static_perfect_hash_map.h"
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kLookup = 1000000U;
+constexpr std::size_t kCommandCount = 16U;
+
+using CommandMap = ::estd::StaticPerfectHashMap<char const *, int, kCommandCount>;
+
+constexpr CommandMap::value_type kCommandList[kCommandCount] = {
+    {"GET", 0},     {"SET", 1},     {"DEL", 2},     {"EXISTS", 3},    {"EXPIRE", 4},     {"TTL", 5},
+    {"INCR", 6},    {"DECR", 7},    {"APPEND", 8},  {"STRLEN", 9},    {"LPUSH", 10},     {"RPUSH", 11},
+    {"LPOP", 12},   {"RPOP", 13},   {"LLEN", 14},   {"PUBLISH", 15},
+};
+constexpr CommandMap kCommands{kCommandList};
+
+constexpr std::size_t kRegisterCount = 256U;
+using RegisterMap = ::estd::StaticPerfectHashMap<std::uint32_t, std::uint32_t, kRegisterCount>;
+
+constexpr ::estd::Array<RegisterMap::value_type, kRegisterCount> make_registers() {
+  ::estd::Array<RegisterMap::value_type, kRegisterCount> registers{};
+  for (std::uint32_t i = 0U; i < kRegisterCount; ++i) {
+    registers[i] = RegisterMap::value_type{0x40000000U + i * 0x40U, i};
+  }
+  return registers;
+}
+constexpr ::estd::Array<RegisterMap::value_type, kRegisterCount> kRegisterList = make_registers();
+constexpr RegisterMap kRegisters{kRegisterList};
+
+void run_commands() {
+  // requests are copied out of the table so that pointer identity cannot short cut the compare
+  std::vector<std::string> names{};
+  for (CommandMap::value_type const &command : kCommandList) {
+    names.emplace_back(command.key);
+  }
+  std::mt19937 random{1U};
+  std::vector<char const *> requests(kLookup);
+  for (char const *&request : requests) {
+    request = names[random() % kCommandCount].c_str();
+  }
+  std::unordered_map<std::string, int> std_map{};
+  for (CommandMap::value_type const &command : kCommandList) {
+    std_map.emplace(command.key, command.value);
+  }
+
+  bench::run("linear scan strcmp 16 commands", kLookup, [&requests]() {
+    for (char const *request : requests) {
+      for (CommandMap::value_type const &command : kCommandList) {
+        if (std::strcmp(command.key, request) == 0) {
+          bench::do_not_optimize(command.value);
+          break;
+        }
+      }
+    }
+  });
+  bench::run("std::unordered_map<std::string> 16 commands", kLookup, [&requests, &std_map]() {
+    for (char const *request : requests) {
+      bench::do_not_optimize(std_map.find(request)->second);
+    }
+  });
+  bench::run("StaticPerfectHashMap 16 commands", kLookup, [&requests]() {
+    for (char const *request : requests) {
+      bench::do_not_optimize(*kCommands.find(request));
+    }
+  });
+}
+
+void run_registers() {
+  std::mt19937 random{2U};
+  std::vector<std::uint32_t> requests(kLookup);
+  for (std::uint32_t &request : requests) {
+    request = kRegisterList[random() % kRegisterCount].key;
+  }
+  static ::estd::StaticHashMap<std::uint32_t, std::uint32_t, 512U> map{};
+  for (RegisterMap::value_type const &reg : kRegisterList) {
+    map.insert(reg.key, reg.value);
+  }
+
+  bench::run("linear scan 256 registers", kLookup, [&requests]() {
+    for (std::uint32_t request : requests) {
+      for (RegisterMap::value_type const &reg : kRegisterList) {
+        if (reg.key == request) {
+          bench::do_not_optimize(reg.value);
+          break;
+        }
+      }
+    }
+  });
+  bench::run("StaticHashMap 256 registers", kLookup, [&requests]() {
+    for (std::uint32_t request : requests) {
+      bench::do_not_optimize(*map.find(request));
+    }
+  });
+  bench::run("StaticPerfectHashMap 256 registers", kLookup, [&requests]() {
+    for (std::uint32_t request : requests) {
+      bench::do_not_optimize(*kRegisters.find(request));
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_commands();
+  run_registers();
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "static_perfect_hash_map.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <set>
+#include <string>
+
+namespace {
+
+using CommandMap = ::estd::StaticPerfectHashMap<char const *, int, 6U>;
+
+constexpr CommandMap kCommands = ::estd::make_static_perfect_hash_map<char const *, int>({
+    {"GET", 1},
+    {"PUT", 2},
+    {"DELETE", 3},
+    {"HEAD", 4},
+    {"OPTIONS", 5},
+    {"", 6},
+});
+
+constexpr std::size_t kRegisterCount = 300U;
+using RegisterMap = ::estd::StaticPerfectHashMap<std::uint32_t, std::uint32_t, kRegisterCount>;
+
+constexpr ::estd::Array<RegisterMap::value_type, kRegisterCount> make_registers() {
+  ::estd::Array<RegisterMap::value_type, kRegisterCount> registers{};
+  for (std::uint32_t i = 0U; i < kRegisterCount; ++i) {
+    registers[i] = RegisterMap::value_type{0x40000000U + i * 4U, i};
+  }
+  return registers;
+}
+
+constexpr RegisterMap kRegisters{make_registers()};
+
+} // namespace
+
+TEST(StaticPerfectHashMap, string_keys_in_constant_expression) {
+  static_assert(kCommands.size() == 6U, "");
+  static_assert(kCommands.at("GET") == 1, "");
+  static_assert(kCommands.at("OPTIONS") == 5, "");
+  static_assert(kCommands.at("") == 6, "");
+  static_assert(kCommands.find("POST") == nullptr, "");
+  static_assert(!kCommands.contains("GETX") && !kCommands.contains("GE"), "");
+  std::string const put{"PUT"};
+  ASSERT_NE(kCommands.find(put.c_str()), nullptr);
+  EXPECT_EQ(*kCommands.find(put.c_str()), 2);
+  EXPECT_EQ(kCommands.find(std::string{"delete"}.c_str()), nullptr);
+}
+
+TEST(StaticPerfectHashMap, integer_keys_one_probe_each) {
+  static_assert(kRegisters.at(0x40000000U) == 0U, "");
+  static_assert(kRegisters.at(0x40000000U + 299U * 4U) == 299U, "");
+  static_assert(kRegisters.find(0x40000002U) == nullptr, "");
+  EXPECT_GE(kRegisters.slot_count(), kRegisterCount);
+  for (std::uint32_t i = 0U; i < kRegisterCount; ++i) {
+    ASSERT_NE(kRegisters.find(0x40000000U + i * 4U), nullptr);
+    EXPECT_EQ(*kRegisters.find(0x40000000U + i * 4U), i);
+    EXPECT_FALSE(kRegisters.contains(0x40000001U + i * 4U));
+  }
+  EXPECT_FALSE(kRegisters.contains(0U));
+}
+
+TEST(StaticPerfectHashMap, runtime_construction) {
+  RegisterMap::value_type const entries[] = {{7U, 70U}};
+  ::estd::StaticPerfectHashMap<std::uint32_t, std::uint32_t, 1U> const single{entries};
+  EXPECT_EQ(single.at(7U), 70U);
+  EXPECT_FALSE(single.contains(0U));
+
+  ::estd::StaticPerfectHashMap<std::uint32_t, std::uint32_t, kRegisterCount> const map{make_registers()};
+  std::set<std::uint32_t> seen{};
+  for (std::uint32_t i = 0U; i < kRegisterCount; ++i) {
+    std::uint32_t const *const value = map.find(0x40000000U + i * 4U);
+    ASSERT_NE(value, nullptr);
+    EXPECT_TRUE(seen.insert(*value).second);
+  }
+}
+
+TEST(StaticPerfectHashMapDeathTest, duplicate_key) {
+  using Map = ::estd::StaticPerfectHashMap<char const *, int, 3U>;
+  Map::value_type const entries[] = {{"A", 1}, {"B", 2}, {"A", 3}};
+  EXPECT_DEATH(Map{entries}, "");
+}
@@ -0,0 +1,101 @@
+#include "static_string.h"
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <string>
+
+TEST(StaticString, length_is_stored_in_place) {
+  static_assert(sizeof(::estd::StaticString<15U>) == 16U, "");
+  static_assert(sizeof(::estd::StaticString<255U>) == 256U, "");
+  ::estd::StaticString<3U> text{};
+  EXPECT_TRUE(text.empty());
+  EXPECT_STREQ(text.c_str(), "");
+  text.append("abc");
+  EXPECT_TRUE(text.full());
+  EXPECT_EQ(text.size(), 3U);
+  EXPECT_STREQ(text.c_str(), "abc");
+  text.pop_back();
+  EXPECT_EQ(text.size(), 2U);
+  EXPECT_STREQ(text.c_str(), "ab");
+}
+
+TEST(StaticString, large_capacity_stores_size) {
+  ::estd::StaticString<300U> text(300U, 'x');
+  EXPECT_TRUE(text.full());
+  EXPECT_EQ(std::strlen(text.c_str()), 300U);
+  text.resize(10U);
+  EXPECT_EQ(text.size(), 10U);
+  EXPECT_EQ(std::strlen(text.c_str()), 10U);
+  text.resize(12U, 'y');
+  EXPECT_EQ(text, "xxxxxxxxxxyy");
+}
+
+TEST(StaticString, append_and_compare) {
+  ::estd::StaticString<32U> text{"temp"};
+  text += '=';
+  text.append_integer(-21).append(",").append_integer(std::uint64_t{1234567890123U});
+  text += " C";
+  EXPECT_EQ(text, "temp=-21,1234567890123 C");
+  EXPECT_TRUE(text == ::estd::StringView{"temp=-21,1234567890123 C"});
+  EXPECT_TRUE(text != "temp");
+  EXPECT_TRUE(text.starts_with("temp=") && text.ends_with(" C"));
+  EXPECT_EQ(text.compare("temq"), -1);
+
+  ::estd::StaticString<32U> copy{text};
+  copy[0] = 'T';
+  EXPECT_EQ(copy.front(), 'T');
+  EXPECT_EQ(text.front(), 't');
+  ::estd::StaticString<64U> const wider{::estd::StringView{copy}};
+  EXPECT_EQ(wider, copy);
+
+  copy = ::estd::StringView{"reset"};
+  EXPECT_EQ(copy, "reset");
+  copy.append(copy.substr(1U, 3U));
+  EXPECT_EQ(copy, "resetese");
+}
+
+TEST(StaticString, search_and_parse) {
+  ::estd::StaticString<32U> const line{"id=42;state=ok"};
+  std::size_t const split = line.find(';');
+  ::estd::StringView const id = line.substr(3U, split - 3U);
+  EXPECT_EQ(id.data(), line.data() + 3);
+  int value = 0;
+  EXPECT_TRUE(id.to_integer(value));
+  EXPECT_EQ(value, 42);
+  EXPECT_EQ(line.find("state"), 6U);
+  EXPECT_EQ(line.find_first_of("=;", 3U), 5U);
+  EXPECT_EQ(line.find('x'), ::estd::StaticString<32U>::npos);
+  EXPECT_FALSE(line.to_integer(value));
+}
+
+TEST(StaticString, assign_view_of_itself) {
+  ::estd::StaticString<16U> text{"hello"};
+  text = text.substr(0U, 3U);
+  EXPECT_EQ(text.size(), 3U);
+  EXPECT_STREQ(text.c_str(), "hel");
+  text = ::estd::StringView{text};
+  EXPECT_EQ(text.size(), 3U);
+  EXPECT_STREQ(text.c_str(), "hel");
+  text = text.substr(1U);
+  EXPECT_STREQ(text.c_str(), "el");
+
+  // full short string, the in place size shares the last byte
+  ::estd::StaticString<3U> full{"abc"};
+  full = full.substr(0U, 2U);
+  EXPECT_EQ(full.size(), 2U);
+  EXPECT_STREQ(full.c_str(), "ab");
+
+  ::estd::StaticString<300U> large{"hello"};
+  large = large.substr(0U, 4U);
+  EXPECT_EQ(large.size(), 4U);
+  EXPECT_STREQ(large.c_str(), "hell");
+}
+
+TEST(StaticStringDeathTest, overflow) {
+  ::estd::StaticString<4U> text{"abcd"};
+  EXPECT_DEATH(text.push_back('e'), "");
+  EXPECT_DEATH(text.append("e"), "");
+  ::estd::StaticString<4U> number{"1"};
+  EXPECT_DEATH(number.append_integer(1234), "");
+  EXPECT_DEATH(text.at(4U), "");
+}
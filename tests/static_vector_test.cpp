@@ -0,0 +1,175 @@
+#include "static_vector.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+struct Counted {
+  static int constructed;
+  static int destroyed;
+  static void reset() {
+    constructed = 0;
+    destroyed = 0;
+  }
+
+  explicit Counted(int v) : value_{v} { ++constructed; }
+  Counted(Counted const &other) : value_{other.value_} { ++constructed; }
+  Counted(Counted &&other) noexcept : value_{other.value_} {
+    other.value_ = -1;
+    ++constructed;
+  }
+  Counted &operator=(Counted const &other) = default;
+  Counted &operator=(Counted &&other) noexcept {
+    value_ = other.value_;
+    other.value_ = -1;
+    return *this;
+  }
+  ~Counted() { ++destroyed; }
+
+  int value_;
+};
+int Counted::constructed = 0;
+int Counted::destroyed = 0;
+
+} // namespace
+
+TEST(StaticVector, default_constructor_does_not_construct_elements) {
+  Counted::reset();
+  {
+    ::estd::StaticVector<Counted, 16> vector{};
+    EXPECT_TRUE(vector.empty());
+    EXPECT_EQ(vector.size(), 0U);
+    EXPECT_EQ(vector.capacity(), 16U);
+  }
+  EXPECT_EQ(Counted::constructed, 0);
+  EXPECT_EQ(Counted::destroyed, 0);
+}
+
+TEST(StaticVector, constructor) {
+  ::estd::StaticVector<int, 5> const vector{1, 2, 3};
+  EXPECT_EQ(vector.size(), 3U);
+  EXPECT_EQ(vector[0], 1);
+  EXPECT_EQ(vector.at(1), 2);
+  EXPECT_EQ(vector.back(), 3);
+}
+
+TEST(StaticVector, push_and_pop) {
+  Counted::reset();
+  {
+    ::estd::StaticVector<Counted, 4> vector{};
+    vector.emplace_back(1);
+    vector.push_back(Counted{2});
+    Counted const c{3};
+    vector.push_back(c);
+    EXPECT_EQ(vector.size(), 3U);
+    EXPECT_EQ(vector.front().value_, 1);
+    EXPECT_EQ(vector.back().value_, 3);
+    vector.pop_back();
+    EXPECT_EQ(vector.size(), 2U);
+    EXPECT_EQ(vector.back().value_, 2);
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+TEST(StaticVector, insert) {
+  ::estd::StaticVector<std::string, 8> vector{"a", "c"};
+  auto it = vector.insert(vector.begin() + 1, "b");
+  EXPECT_EQ(*it, "b");
+  vector.insert(vector.end(), std::string{"d"});
+  vector.emplace(vector.begin(), 3U, 'z');
+  ASSERT_EQ(vector.size(), 5U);
+  EXPECT_EQ(vector[0], "zzz");
+  EXPECT_EQ(vector[1], "a");
+  EXPECT_EQ(vector[2], "b");
+  EXPECT_EQ(vector[3], "c");
+  EXPECT_EQ(vector[4], "d");
+}
+
+TEST(StaticVector, insert_trivial) {
+  ::estd::StaticVector<int, 8> vector{1, 3, 4};
+  vector.insert(vector.begin() + 1, 2);
+  vector.insert(vector.begin(), vector[3]);
+  EXPECT_EQ(vector, (::estd::StaticVector<int, 8>{4, 1, 2, 3, 4}));
+}
+
+TEST(StaticVector, erase) {
+  Counted::reset();
+  {
+    ::estd::StaticVector<Counted, 8> vector{};
+    for (int i = 0; i < 6; ++i) {
+      vector.emplace_back(i);
+    }
+    auto it = vector.erase(vector.begin() + 1);
+    EXPECT_EQ(it->value_, 2);
+    it = vector.erase(vector.begin() + 1, vector.begin() + 3);
+    EXPECT_EQ(it->value_, 4);
+    ASSERT_EQ(vector.size(), 3U);
+    EXPECT_EQ(vector[0].value_, 0);
+    EXPECT_EQ(vector[1].value_, 4);
+    EXPECT_EQ(vector[2].value_, 5);
+    EXPECT_EQ(Counted::constructed - Counted::destroyed, 3);
+  }
+  EXPECT_EQ(Counted::constructed, Counted::destroyed);
+}
+
+TEST(StaticVector, erase_trivial) {
+  ::estd::StaticVector<int, 8> vector{0, 1, 2, 3, 4, 5};
+  vector.erase(vector.begin(), vector.begin() + 2);
+  vector.erase(vector.end() - 1);
+  EXPECT_EQ(vector, (::estd::StaticVector<int, 8>{2, 3, 4}));
+}
+
+TEST(StaticVector, copy_and_move) {
+  ::estd::StaticVector<std::string, 4> vector{"a", "b"};
+  ::estd::StaticVector<std::string, 4> copy{vector};
+  EXPECT_EQ(copy, vector);
+  ::estd::StaticVector<std::string, 4> moved{::estd::move(copy)};
+  EXPECT_EQ(moved, vector);
+  ::estd::StaticVector<std::string, 4> assigned{"x"};
+  assigned = vector;
+  EXPECT_EQ(assigned, vector);
+  assigned.clear();
+  EXPECT_TRUE(assigned.empty());
+}
+
+namespace {
+
+struct ThrowingMove {
+  ThrowingMove() = default;
+  ThrowingMove(ThrowingMove const &) = default;
+  ThrowingMove(ThrowingMove &&) noexcept(false) {}
+};
+
+} // namespace
+
+TEST(StaticVector, move_is_noexcept_when_element_move_is) {
+  static_assert(std::is_nothrow_move_constructible<::estd::StaticVector<int, 4>>::value, "");
+  static_assert(std::is_nothrow_move_assignable<::estd::StaticVector<int, 4>>::value, "");
+  static_assert(std::is_nothrow_move_constructible<::estd::StaticVector<std::string, 4>>::value, "");
+  static_assert(!std::is_nothrow_move_constructible<::estd::StaticVector<ThrowingMove, 4>>::value, "");
+  // relocating vectors moves them instead of copying
+  ::estd::StaticVector<std::string, 4> vector{"a", "b"};
+  static_assert(std::is_rvalue_reference<decltype(::estd::move_if_noexcept(vector))>::value, "");
+  ::estd::StaticVector<std::string, 4> moved{::estd::move_if_noexcept(vector)};
+  EXPECT_EQ(moved.size(), 2U);
+  EXPECT_EQ(moved[1], "b");
+}
+
+TEST(StaticVector, single_value_constructor_is_explicit) {
+  static_assert(!std::is_convertible<int, ::estd::StaticVector<int, 4>>::value, "");
+  static_assert(std::is_constructible<::estd::StaticVector<int, 4>, int>::value, "");
+  ::estd::StaticVector<int, 4> const vector{5};
+  EXPECT_EQ(vector.size(), 1U);
+  EXPECT_EQ(vector[0], 5);
+}
+
+TEST(StaticVectorDeathTest, push_back_full) {
+  ::estd::StaticVector<int, 2> vector{1, 2};
+  ASSERT_DEATH(vector.push_back(3), "");
+}
+
+TEST(StaticVectorDeathTest, at_out_of_range) {
+  ::estd::StaticVector<int, 5> const vector{1, 2, 3};
+  ASSERT_DEATH(vector.at(3), "");
+}
@@ -0,0 +1,144 @@
+#include "benchmark.h"
+#include "static_string.h"
+#include "string_view.h"
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kTextSize = 4096U;
+constexpr std::size_t kSearch = 100000U;
+constexpr std::size_t kConvert = 1000000U;
+
+void run_search() {
+  std::mt19937 random{1U};
+  std::string text(kTextSize, ' ');
+  for (char &ch : text) {
+    ch = static_cast<char>('a' + random() % 26U);
+  }
+  // the needles only appear at the end, every search scans the whole text
+  text[kTextSize - 2U] = '=';
+  text[kTextSize - 1U] = ';';
+  std::string_view const std_view{text};
+  ::estd::StringView const view{text.data(), text.size()};
+
+  char name[96];
+  std::snprintf(name, sizeof(name), "std::string_view::find char %zu bytes", kTextSize);
+  bench::run(name, kSearch, [&std_view]() {
+    for (std::size_t i = 0U; i < kSearch; ++i) {
+      bench::do_not_optimize(std_view.find('='));
+    }
+  });
+  std::snprintf(name, sizeof(name), "estd::StringView::find char %zu bytes", kTextSize);
+  bench::run(name, kSearch, [&view]() {
+    for (std::size_t i = 0U; i < kSearch; ++i) {
+      bench::do_not_optimize(view.find('='));
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::string_view::find_first_of 3 %zu bytes", kTextSize);
+  bench::run(name, kSearch, [&std_view]() {
+    for (std::size_t i = 0U; i < kSearch; ++i) {
+      bench::do_not_optimize(std_view.find_first_of("=;\n"));
+    }
+  });
+  std::snprintf(name, sizeof(name), "estd::StringView::find_first_of 3 %zu bytes", kTextSize);
+  bench::run(name, kSearch, [&view]() {
+    for (std::size_t i = 0U; i < kSearch; ++i) {
+      bench::do_not_optimize(view.find_first_of("=;\n"));
+    }
+  });
+  std::snprintf(name, sizeof(name), "std::string_view::find substring %zu bytes", kTextSize);
+  bench::run(name, kSearch / 10U, [&std_view]() {
+    for (std::size_t i = 0U; i < kSearch / 10U; ++i) {
+      bench::do_not_optimize(std_view.find("=;"));
+    }
+  });
+  std::snprintf(name, sizeof(name), "estd::StringView::find substring %zu bytes", kTextSize);
+  bench::run(name, kSearch / 10U, [&view]() {
+    for (std::size_t i = 0U; i < kSearch / 10U; ++i) {
+      bench::do_not_optimize(view.find("=;"));
+    }
+  });
+}
+
+void run_convert() {
+  std::mt19937_64 random{2U};
+  std::vector<std::int64_t> values(kConvert);
+  for (std::int64_t &value : values) {
+    value = static_cast<std::int64_t>(random()) >> (random() % 64U);
+  }
+  bench::run("std::to_string int64", kConvert, [&values]() {
+    for (std::int64_t value : values) {
+      bench::do_not_optimize(std::to_string(value).size());
+    }
+  });
+  bench::run("std::to_chars int64", kConvert, [&values]() {
+    char buffer[24];
+    for (std::int64_t value : values) {
+      bench::do_not_optimize(std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+    }
+  });
+  bench::run("estd::to_chars int64", kConvert, [&values]() {
+    char buffer[24];
+    for (std::int64_t value : values) {
+      bench::do_not_optimize(::estd::to_chars(buffer, buffer + sizeof(buffer), value));
+    }
+  });
+
+  std::vector<std::string> texts{};
+  for (std::int64_t value : values) {
+    texts.push_back(std::to_string(value));
+  }
+  bench::run("std::strtoll int64", kConvert, [&texts]() {
+    for (std::string const &text : texts) {
+      bench::do_not_optimize(std::strtoll(text.c_str(), nullptr, 10));
+    }
+  });
+  bench::run("std::from_chars int64", kConvert, [&texts]() {
+    for (std::string const &text : texts) {
+      std::int64_t value = 0;
+      std::from_chars(text.data(), text.data() + text.size(), value);
+      bench::do_not_optimize(value);
+    }
+  });
+  bench::run("estd::from_chars int64", kConvert, [&texts]() {
+    for (std::string const &text : texts) {
+      std::int64_t value = 0;
+      ::estd::from_chars(text.data(), text.data() + text.size(), value);
+      bench::do_not_optimize(value);
+    }
+  });
+}
+
+// formats a telemetry line "sensor=<id>;value=<value>;"
+void run_append() {
+  bench::run("std::string telemetry line", kConvert, []() {
+    for (std::size_t i = 0U; i < kConvert; ++i) {
+      std::string line{};
+      line.append("sensor=").append(std::to_string(i % 64U)).append(";value=").append(std::to_string(i)).append(";");
+      bench::do_not_optimize(line.size());
+    }
+  });
+  bench::run("estd::StaticString<64> telemetry line", kConvert, []() {
+    for (std::size_t i = 0U; i < kConvert; ++i) {
+      ::estd::StaticString<64U> line{};
+      line.append("sensor=").append_integer(i % 64U).append(";value=").append_integer(i).append(";");
+      bench::do_not_optimize(line.size());
+    }
+  });
+}
+
+} // namespace
+
+int main() {
+  run_search();
+  run_convert();
+  run_append();
+  return 0;
+}
@@ -0,0 +1,120 @@
+#include "string_view.h"
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+
+namespace {
+
+std::string to_string(::estd::StringView view) { return std::string{view.data(), view.size()}; }
+
+} // namespace
+
+TEST(StringView, construct_and_access) {
+  constexpr ::estd::StringView empty{};
+  static_assert(empty.empty() && empty.size() == 0U, "");
+#if ESTD_HAS_CONSTANT_EVALUATED
+  constexpr ::estd::StringView hello{"hello"};
+  static_assert(hello.size() == 5U && hello[1] == 'e' && hello.front() == 'h' && hello.back() == 'o', "");
+  static_assert(hello.substr(1U, 3U) == ::estd::StringView{"ell"}, "");
+  static_assert(hello.starts_with("he") && hello.ends_with("llo") && !hello.ends_with("hello!"), "");
+  static_assert(::estd::StringView{"abc"} < ::estd::StringView{"abd"}, "");
+  static_assert(::estd::StringView{"ab"} < ::estd::StringView{"abc"}, "");
+#endif
+
+  char const buffer[] = {'a', 'b', '\0', 'c'};
+  ::estd::StringView const binary{buffer, sizeof(buffer)};
+  EXPECT_EQ(binary.size(), 4U);
+  EXPECT_EQ(binary.find('c'), 3U);
+  EXPECT_EQ(binary.at(2U), '\0');
+}
+
+TEST(StringView, substr_does_not_copy) {
+  std::string const text{"temperature=21"};
+  ::estd::StringView view{text.c_str()};
+  ::estd::StringView const key = view.substr(0U, view.find('='));
+  ::estd::StringView const value = view.substr(view.find('=') + 1U);
+  EXPECT_EQ(key.data(), text.data());
+  EXPECT_EQ(to_string(key), "temperature");
+  EXPECT_EQ(to_string(value), "21");
+  EXPECT_EQ(view.substr(view.size()).size(), 0U);
+  EXPECT_EQ(view.substr(3U, 100U).size(), text.size() - 3U);
+  view.remove_prefix(12U);
+  view.remove_suffix(1U);
+  EXPECT_EQ(to_string(view), "2");
+}
+
+TEST(StringView, compare) {
+  EXPECT_EQ(::estd::StringView{"abc"}.compare("abc"), 0);
+  EXPECT_LT(::estd::StringView{"abc"}.compare("abd"), 0);
+  EXPECT_GT(::estd::StringView{"abc"}.compare("ab"), 0);
+  EXPECT_LT(::estd::StringView{"a"}.compare("\xff"), 0);
+  EXPECT_TRUE(::estd::StringView{} == ::estd::StringView{""});
+  EXPECT_TRUE(::estd::StringView{"x"} != ::estd::StringView{"y"});
+  EXPECT_TRUE(::estd::StringView{"b"} >= ::estd::StringView{"a"});
+}
+
+TEST(StringView, find_char_and_substring) {
+  ::estd::StringView const text{"the quick brown fox jumps over the lazy dog, the end"};
+  std::string const reference{text.data(), text.size()};
+  for (char ch : std::string{"tqz,dX"}) {
+    for (std::size_t pos = 0U; pos <= text.size() + 1U; ++pos) {
+      EXPECT_EQ(text.find(ch, pos), reference.find(ch, pos));
+    }
+  }
+  for (char const *needle : {"the", "fox", "dog, t", "end", "ends", "", "the quick brown fox jumps over the lazy"}) {
+    for (std::size_t pos = 0U; pos <= text.size() + 1U; ++pos) {
+      EXPECT_EQ(text.find(needle, pos), reference.find(needle, pos));
+    }
+  }
+  EXPECT_TRUE(text.contains("lazy"));
+  EXPECT_FALSE(text.contains('X'));
+  EXPECT_EQ(::estd::StringView{}.find('a'), ::estd::StringView::npos);
+}
+
+TEST(StringView, find_first_of) {
+  ::estd::StringView const text{"key=value;other=1,2,3\n"};
+  EXPECT_EQ(text.find_first_of("=;"), 3U);
+  EXPECT_EQ(text.find_first_of("=;", 4U), 9U);
+  EXPECT_EQ(text.find_first_of("\n"), text.size() - 1U);
+  EXPECT_EQ(text.find_first_of(""), ::estd::StringView::npos);
+  EXPECT_EQ(text.find_first_of("XYZ"), ::estd::StringView::npos);
+  // larger sets use a table
+  EXPECT_EQ(text.find_first_of("0123456789"), 16U);
+}
+
+// compares every kernel result with std::string on random text, lengths cover whole blocks and scalar tails
+TEST(StringView, search_random_against_std) {
+  std::mt19937 random{7U};
+  for (std::size_t size = 0U; size < 200U; ++size) {
+    std::string text(size, 'a');
+    for (char &ch : text) {
+      ch = static_cast<char>('a' + random() % 20U);
+    }
+    ::estd::StringView const view{text.data(), text.size()};
+    for (char const *set : {"t", "st", "xyz", "abcdefgh", "pqrstuvwxyz", "\x80"}) {
+      std::size_t const pos = size == 0U ? 0U : random() % size;
+      EXPECT_EQ(view.find_first_of(set, pos), text.find_first_of(set, pos)) << size << " " << set;
+    }
+    for (char const *needle : {"ab", "tsr", "q"}) {
+      EXPECT_EQ(view.find(needle), text.find(needle)) << size << " " << needle;
+    }
+  }
+}
+
+TEST(StringView, to_integer) {
+  int value = 0;
+  EXPECT_TRUE(::estd::StringView{"-42"}.to_integer(value));
+  EXPECT_EQ(value, -42);
+  EXPECT_FALSE(::estd::StringView{"42 "}.to_integer(value));
+  EXPECT_FALSE(::estd::StringView{""}.to_integer(value));
+  EXPECT_FALSE(::estd::StringView{"99999999999"}.to_integer(value));
+  EXPECT_EQ(value, -42);
+  std::uint16_t port = 0U;
+  EXPECT_TRUE(::estd::StringView{"host:8080"}.substr(5U).to_integer(port));
+  EXPECT_EQ(port, 8080U);
+}
+
+TEST(StringViewDeathTest, substr_out_of_range) {
+  EXPECT_DEATH(::estd::StringView{"abc"}.substr(4U), "");
+}
@@ -0,0 +1,41 @@
+#include "benchmark.h"
+#include "timer_wheel.h"
+#include <random>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t kTimerCount = 100000U;
+
+} // namespace
+
+int main() {
+  std::mt19937 random{1U};
+  std::vector<::estd::Timer::tick_type> delays(kTimerCount);
+  for (auto &delay : delays) {
+    delay = 1U + random() % 100000U;
+  }
+  std::vector<::estd::Timer> timers(kTimerCount);
+  static ::estd::TimerWheel<4, 64> wheel{};
+
+  bench::run("TimerWheel arm 100k", kTimerCount, [&timers, &delays]() {
+    for (std::size_t i = 0U; i < kTimerCount; ++i) {
+      wheel.arm_after(timers[i], delays[i]);
+    }
+  });
+  bench::run("TimerWheel cancel 100k", kTimerCount, [&timers]() {
+    for (::estd::Timer &timer : timers) {
+      wheel.cancel(timer);
+    }
+  });
+
+  for (std::size_t i = 0U; i < kTimerCount; ++i) {
+    wheel.arm_after(timers[i], delays[i]);
+  }
+  std::size_t fired = 0U;
+  bench::run("TimerWheel tick until 100k expired (per timer)", kTimerCount, [&fired]() {
+    wheel.advance(wheel.now() + 100001U, [&fired](::estd::Timer &) { ++fired; });
+  });
+  bench::do_not_optimize(fired);
+  return 0;
+}
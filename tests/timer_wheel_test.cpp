@@ -0,0 +1,108 @@
+#include "timer_wheel.h"
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+using tick_type = ::estd::Timer::tick_type;
+
+struct Task : ::estd::Timer {
+  int id_{};
+  tick_type fired_at_{0U};
+};
+
+} // namespace
+
+TEST(TimerWheel, expire_in_order) {
+  ::estd::TimerWheel<3, 8> wheel{};
+  Task tasks[4]{};
+  tick_type const expiries[4] = {3U, 8U, 70U, 600U};
+  for (int i = 0; i < 4; ++i) {
+    tasks[i].id_ = i;
+    wheel.arm(tasks[i], expiries[i]);
+    EXPECT_TRUE(tasks[i].armed());
+  }
+  EXPECT_EQ(wheel.size(), 4U);
+  std::vector<int> fired{};
+  wheel.advance(1000U, [&fired, &wheel](::estd::Timer &timer) {
+    Task &task = static_cast<Task &>(timer);
+    task.fired_at_ = wheel.now();
+    fired.push_back(task.id_);
+  });
+  EXPECT_EQ(fired, (std::vector<int>{0, 1, 2, 3}));
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(tasks[i].fired_at_, expiries[i]);
+    EXPECT_FALSE(tasks[i].armed());
+  }
+  EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, cancel_and_rearm) {
+  ::estd::TimerWheel<2, 16> wheel{};
+  Task a{};
+  Task b{};
+  wheel.arm_after(a, 5U);
+  wheel.arm_after(b, 5U);
+  wheel.cancel(a);
+  EXPECT_FALSE(a.armed());
+  wheel.arm_after(b, 20U);
+  int count = 0;
+  wheel.advance(19U, [&count](::estd::Timer &) { ++count; });
+  EXPECT_EQ(count, 0);
+  wheel.tick([&count](::estd::Timer &timer) {
+    ++count;
+    EXPECT_EQ(timer.expiry(), 20U);
+  });
+  EXPECT_EQ(count, 1);
+}
+
+TEST(TimerWheel, destroyed_timer_unlinks_itself) {
+  ::estd::TimerWheel<2, 8> wheel{};
+  {
+    Task task{};
+    wheel.arm_after(task, 3U);
+    EXPECT_EQ(wheel.size(), 1U);
+  }
+  EXPECT_TRUE(wheel.empty());
+  wheel.advance(10U, [](::estd::Timer &) { FAIL(); });
+}
+
+TEST(TimerWheel, out_of_range_and_past) {
+  ::estd::TimerWheel<2, 4> wheel{5U};
+  Task far{};
+  Task past{};
+  wheel.arm(far, 5U + 100U);
+  wheel.arm(past, 1U);
+  std::vector<tick_type> fired{};
+  wheel.advance(200U, [&fired, &wheel](::estd::Timer &) { fired.push_back(wheel.now()); });
+  EXPECT_EQ(fired, (std::vector<tick_type>{6U, 105U}));
+}
+
+TEST(TimerWheel, random) {
+  ::estd::TimerWheel<4, 8> wheel{};
+  std::mt19937 random{42U};
+  std::vector<Task> tasks(500U);
+  std::multimap<tick_type, Task *> expect{};
+  for (Task &task : tasks) {
+    tick_type const expiry = 1U + random() % 5000U;
+    wheel.arm(task, expiry);
+    expect.emplace(expiry, &task);
+  }
+  for (std::size_t i = 0U; i < tasks.size(); i += 3U) {
+    wheel.cancel(tasks[i]);
+    for (auto it = expect.begin(); it != expect.end(); ++it) {
+      if (it->second == &tasks[i]) {
+        expect.erase(it);
+        break;
+      }
+    }
+  }
+  std::size_t fired = 0U;
+  wheel.advance(6000U, [&fired, &wheel](::estd::Timer &timer) {
+    EXPECT_EQ(timer.expiry(), wheel.now());
+    ++fired;
+  });
+  EXPECT_EQ(fired, expect.size());
+}
@@ -0,0 +1,56 @@
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <type_traits>
+
+namespace {
+
+struct ThrowingMove {
+  ThrowingMove() = default;
+  ThrowingMove(ThrowingMove const &) = default;
+  ThrowingMove(ThrowingMove &&) noexcept(false) {}
+};
+
+struct MoveOnly {
+  MoveOnly() = default;
+  MoveOnly(MoveOnly const &) = delete;
+  MoveOnly(MoveOnly &&) noexcept(false) {}
+};
+
+template <::estd::size_t... I> constexpr ::estd::size_t sum(::estd::index_sequence<I...>) {
+  ::estd::size_t result = 0U;
+  for (::estd::size_t value : {::estd::size_t{0U}, I...}) {
+    result += value;
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(Utility, exchange) {
+  std::string value{"old"};
+  std::string const old = ::estd::exchange(value, "new");
+  EXPECT_EQ(old, "old");
+  EXPECT_EQ(value, "new");
+
+  int counter = 1;
+  EXPECT_EQ(::estd::exchange(counter, 2), 1);
+  EXPECT_EQ(counter, 2);
+}
+
+TEST(Utility, move_if_noexcept) {
+  std::string movable{};
+  ThrowingMove throwing{};
+  MoveOnly move_only{};
+  EXPECT_TRUE((std::is_same<decltype(::estd::move_if_noexcept(movable)), std::string &&>::value));
+  EXPECT_TRUE((std::is_same<decltype(::estd::move_if_noexcept(throwing)), ThrowingMove const &>::value));
+  EXPECT_TRUE((std::is_same<decltype(::estd::move_if_noexcept(move_only)), MoveOnly &&>::value));
+}
+
+TEST(Utility, index_sequence) {
+  static_assert(::estd::make_index_sequence<0U>::size() == 0U, "");
+  static_assert(::estd::make_index_sequence<100U>::size() == 100U, "");
+  static_assert(sum(::estd::make_index_sequence<100U>{}) == 4950U, "");
+  static_assert(std::is_same<::estd::index_sequence_for<int, char, long>, ::estd::index_sequence<0U, 1U, 2U>>::value,
+                "");
+}